@@ -3,6 +3,7 @@
 
 // Stores the API after it has already been fetched.
 ModexAPI::IModexInterface001* g_ModexInterface = nullptr;
+ModexAPI::IModexInterface002* g_ModexInterface002 = nullptr;
 
 // Fetches the interface to use from Modex.
 ModexAPI::IModexInterface001* ModexAPI::GetModexInterface001()
@@ -22,3 +23,23 @@ ModexAPI::IModexInterface001* ModexAPI::GetModexInterface001()
 	g_ModexInterface = static_cast<IModexInterface001*>(message.GetApiFunction(1));
 	return g_ModexInterface;
 }
+
+// Fetches the revision 2 interface. Older Modex builds return nullptr for revisions they
+// don't know, so callers can fall back to GetModexInterface001().
+ModexAPI::IModexInterface002* ModexAPI::GetModexInterface002()
+{
+	if (g_ModexInterface002) {
+		return g_ModexInterface002;
+	}
+
+	ModexMessage message;
+	const auto skseMessaging = SKSE::GetMessagingInterface();
+	skseMessaging->Dispatch(ModexMessage::kMessage_QueryInterface, (void*)&message,
+		sizeof(ModexMessage), ModexPluginName);
+	if (!message.GetApiFunction) {
+		return nullptr;
+	}
+
+	g_ModexInterface002 = static_cast<IModexInterface002*>(message.GetApiFunction(2));
+	return g_ModexInterface002;
+}
@@ -7,7 +7,8 @@
 //
 // Usage:
 //   1. Include this header in your plugin.
-//   2. After SKSE sends kPostLoad, call ModexAPI::GetModexInterface001().
+//   2. After SKSE sends kPostLoad, call ModexAPI::GetModexInterface001(), or
+//      ModexAPI::GetModexInterface002() for the batch query API.
 //   3. Use the returned interface pointer to interact with Modex.
 //
 // Note:
@@ -109,6 +110,75 @@ namespace ModexAPI
 		const char* plugin;
 	};
 
+	// Zero-copy reference into a string owned by Modex's cache. Valid for the lifetime of the
+	// Modex cache (until game exit) and null-terminated; size excludes the terminator.
+	struct StringRef
+	{
+		const char* data{ nullptr };
+		uint32_t    size{ 0 };
+	};
+
+	// Row filter for QueryBatch(). Default-constructed fields match everything.
+	struct BatchFilter
+	{
+		RE::FormType formType{ RE::FormType::None };  // Only forms of this type (None = any)
+		const char*  plugin{ nullptr };               // Only forms from this plugin filename (nullptr = any)
+		bool         playableOnly{ false };           // Skip non-playable forms
+	};
+
+	// Caller-owned parallel arrays filled by QueryBatch(). Every column that is not nullptr must
+	// hold at least `capacity` rows; leave a column nullptr to skip it.
+	//
+	// Plugin indexes are load order slots: full plugins use their compile index (0x00-0xFD),
+	// light plugins use 0x100 + their light index, and 0xFFFF means no plugin. Resolve them
+	// with GetPluginName() once per distinct index instead of per row.
+	struct FormBatch
+	{
+		uint32_t             capacity{ 0 };
+		RE::FormID*          formIDs{ nullptr };
+		RE::FormID*          refIDs{ nullptr };
+		RE::FormType*        formTypes{ nullptr };
+		uint16_t*            pluginIndexes{ nullptr };
+		StringRef*           names{ nullptr };
+		StringRef*           editorIDs{ nullptr };
+
+		// Numeric properties: propertyColumns[i] receives properties[i] for every row. Flags
+		// read as 0 or 1; NaN where the property does not apply to the form or is not numeric.
+		const PropertyType*  properties{ nullptr };
+		double* const*       propertyColumns{ nullptr };
+		uint32_t             propertyCount{ 0 };
+
+		// Out: cache position to pass as a_start on the next call. Equals the cached form
+		// count once the whole cache has been scanned.
+		uint32_t             next{ 0 };
+	};
+
+	// Handle to a compiled query, see IModexInterface002::CompileQuery(). 0 is never valid.
+	using QueryHandle = uint32_t;
+
+	// A search and filter query using the same engines as Modex's own tables.
+	//
+	// Search syntax (case-insensitive), matched against searchProperty:
+	//   text        substring match
+	//   "text"      exact match
+	//   >n, <n      numeric comparison, e.g. ">20" on kWeaponDamage
+	//   ==text      equality, !=text inequality
+	//   %pattern    regular expression search
+	//
+	// filterIDs name nodes from Modex's filter definitions for the cache type
+	// (Data/Interface/Modex/user/filters/<AddItem|Actor|Object|Teleport|Outfit>.json).
+	// Selecting a node also selects its parents, exactly like clicking it in the menu.
+	struct QuerySpec
+	{
+		CacheType          type{ CacheType::kItem };
+		const char*        search{ nullptr };                      // nullptr or empty = no search
+		PropertyType       searchProperty{ PropertyType::kName };
+		const char* const* filterIDs{ nullptr };
+		uint32_t           filterCount{ 0 };
+		bool               matchAllFilters{ false };               // AND sibling nodes instead of OR
+		BatchFilter        filter{};                               // Applied before search and filters
+	};
+
 	// A message used to fetch Modex's interface.
 	struct ModexMessage
 	{
@@ -125,6 +195,11 @@ namespace ModexAPI
 	struct IModexInterface001;
 	IModexInterface001* GetModexInterface001();
 
+	// Returns an IModexInterface002 object, or nullptr if the installed Modex predates it.
+	// This should only be called after SKSE sends kPostLoad to your plugin.
+	struct IModexInterface002;
+	IModexInterface002* GetModexInterface002();
+
 	struct IModexInterface001
 	{
 		/// Returns true if Modex has finished caching form data.
@@ -248,6 +323,40 @@ namespace ModexAPI
 		virtual void SetSleepOutfit(RE::FormID a_outfitFormID, RE::FormID a_targetReference) = 0;
 	};
 
+	// Revision 2 extends revision 1; every IModexInterface001 method is still available.
+	struct IModexInterface002 : public IModexInterface001
+	{
+		/// Fills the requested columns of a_batch with cached forms matching a_filter, scanning
+		/// the cache from position a_start. One call replaces a GetCachedForms() copy plus one
+		/// GetFormProperty() call per form and property.
+		/// @param a_type    The cache category to read from.
+		/// @param a_filter  Rows to include.
+		/// @param a_start   Cache position to resume from (0 for the first page, then a_batch.next).
+		/// @param a_batch   Caller-owned columns; a_batch.next is updated for the following call.
+		/// @return          The number of rows written, at most a_batch.capacity.
+		virtual uint32_t QueryBatch(CacheType a_type, const BatchFilter& a_filter, uint32_t a_start, FormBatch& a_batch) = 0;
+
+		/// Resolves a plugin index from a FormBatch to the plugin's filename.
+		/// @return          An empty StringRef if no plugin is loaded in that slot.
+		virtual StringRef GetPluginName(uint16_t a_pluginIndex) = 0;
+
+		/// Parses and evaluates a query once. The matches are kept until ReleaseQuery(), so
+		/// paging through them with FetchQueryResults() does no further searching.
+		/// @return          0 if data isn't ready, the search property or a filter ID is unknown.
+		virtual QueryHandle CompileQuery(const QuerySpec& a_spec) = 0;
+
+		/// Returns the number of forms the query matched.
+		virtual uint32_t GetQueryResultCount(QueryHandle a_query) = 0;
+
+		/// Fills a_batch with query results starting at result a_offset, in cache order.
+		/// @return          The number of rows written; a_batch.next is the offset of the next page.
+		virtual uint32_t FetchQueryResults(QueryHandle a_query, uint32_t a_offset, FormBatch& a_batch) = 0;
+
+		/// Frees a query's results. The handle is invalid afterwards.
+		virtual void ReleaseQuery(QueryHandle a_query) = 0;
+	};
+
 }  // namespace ModexAPI
 
 extern ModexAPI::IModexInterface001* g_ModexInterface;
+extern ModexAPI::IModexInterface002* g_ModexInterface002;
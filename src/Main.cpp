@@ -2,6 +2,8 @@
 #include "core/Hooks.h"
 #include "core/Graphic.h"
 #include "core/InputManager.h"
+#include "core/CommandJournal.h"
+#include "core/Commands.h"
 #include "data/Data.h"
 #include "ui/core/UIManager.h"
 
@@ -65,6 +67,12 @@ namespace
 			RE::UI::GetSingleton()->GetEventSource<RE::MenuOpenCloseEvent>()->AddEventSink(Hooks::IMenuOpenCloseEvent::GetSingleton());
 			break;
 		case SKSE::MessagingInterface::kPostLoadGame:
+		case SKSE::MessagingInterface::kNewGame:
+			// Scripts may have edited leveled lists in the save; re-project values lazily.
+			Modex::Commands::ClearLeveledValueCache();
+
+			// Journal handles belong to the previous session and can't be replayed.
+			Modex::CommandJournal::GetSingleton()->Clear();
 			break;
 		}
 	}
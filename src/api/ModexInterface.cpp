@@ -6,6 +6,8 @@
 #include "core/Commands.h"
 #include "core/PlayerChestSpawn.h"
 #include "config/UserConfig.h"
+#include "ui/core/FilterSystem.h"
+#include "ui/core/SearchSystem.h"
 #include "ui/core/UIManager.h"
 #include "ui/modules/formselector/FormSelectorOptions.h"
 
@@ -366,12 +368,274 @@ namespace Modex
 		return false;
 	}
 
+	static ModexAPI::StringRef MakeStringRef(const std::string& a_string)
+	{
+		return { a_string.c_str(), static_cast<uint32_t>(a_string.size()) };
+	}
+
+	// Resolves a plugin filter to its load order slot once, so rows compare integers.
+	// INVALID_FILE_INDEX means no plugin filter; nullopt means the plugin isn't loaded.
+	static std::optional<uint16_t> ResolvePluginFilter(const char* a_plugin)
+	{
+		if (!a_plugin || !*a_plugin) {
+			return INVALID_FILE_INDEX;
+		}
+
+		const uint16_t index = PackFileIndex(RE::TESDataHandler::GetSingleton()->LookupModByName(a_plugin));
+		return index == INVALID_FILE_INDEX ? std::nullopt : std::optional<uint16_t>(index);
+	}
+
+	static bool PassesBatchFilter(const BaseObject& a_obj, const ModexAPI::BatchFilter& a_filter, uint16_t a_plugin)
+	{
+		if (a_filter.formType != RE::FormType::None && a_obj.GetFormType() != a_filter.formType)
+			return false;
+
+		if (a_plugin != INVALID_FILE_INDEX && a_obj.GetFileIndex() != a_plugin)
+			return false;
+
+		if (a_filter.playableOnly && !a_obj.IsPlayable())
+			return false;
+
+		return true;
+	}
+
+	// Writes only the columns the caller asked for. Strings are handed out as views into the
+	// cached objects, which live until game exit.
+	static void WriteBatchRow(const BaseObject& a_obj, ModexAPI::FormBatch& a_batch, uint32_t a_row)
+	{
+		if (a_batch.formIDs) a_batch.formIDs[a_row] = a_obj.GetBaseFormID();
+		if (a_batch.refIDs) a_batch.refIDs[a_row] = a_obj.GetRefID();
+		if (a_batch.formTypes) a_batch.formTypes[a_row] = a_obj.GetFormType();
+		if (a_batch.pluginIndexes) a_batch.pluginIndexes[a_row] = a_obj.GetFileIndex();
+		if (a_batch.names) a_batch.names[a_row] = MakeStringRef(a_obj.GetName());
+		if (a_batch.editorIDs) a_batch.editorIDs[a_row] = MakeStringRef(a_obj.GetEditorID());
+
+		if (!a_batch.properties || !a_batch.propertyColumns) {
+			return;
+		}
+
+		for (uint32_t p = 0; p < a_batch.propertyCount; ++p) {
+			double* column = a_batch.propertyColumns[p];
+			if (!column)
+				continue;
+
+			const auto internalProp = static_cast<Modex::PropertyType>(static_cast<uint32_t>(a_batch.properties[p]));
+			column[a_row] = a_obj.GetPropertyAsNumber(internalProp).value_or(std::numeric_limits<double>::quiet_NaN());
+		}
+	}
+
+	uint32_t ModexInterface::QueryBatch(ModexAPI::CacheType a_type, const ModexAPI::BatchFilter& a_filter, uint32_t a_start, ModexAPI::FormBatch& a_batch)
+	{
+		a_batch.next = a_start;
+
+		if (!IsDataReady()) {
+			return 0;
+		}
+
+		auto* list = GetCacheList(a_type);
+		if (!list) {
+			return 0;
+		}
+
+		const uint32_t total = static_cast<uint32_t>(list->size());
+
+		const auto plugin = ResolvePluginFilter(a_filter.plugin);
+		if (!plugin) {
+			a_batch.next = total;
+			return 0;
+		}
+
+		uint32_t count = 0;
+		uint32_t index = (std::min)(a_start, total);
+
+		for (; index < total && count < a_batch.capacity; ++index) {
+			const auto& obj = (*list)[index];
+
+			if (!PassesBatchFilter(obj, a_filter, *plugin))
+				continue;
+
+			WriteBatchRow(obj, a_batch, count++);
+		}
+
+		a_batch.next = index;
+		return count;
+	}
+
+	// Positions in the cache list that matched, evaluated once at compile time.
+	struct CompiledQuery
+	{
+		ModexAPI::CacheType   type;
+		std::vector<uint32_t> rows;
+	};
+
+	// Filter definitions are shared with the module tables of the same data id.
+	static const char* GetFilterTableID(ModexAPI::CacheType a_type)
+	{
+		switch (a_type) {
+		case ModexAPI::CacheType::kItem:   return "AddItem";
+		case ModexAPI::CacheType::kNPC:    return "Actor";
+		case ModexAPI::CacheType::kObject: return "Object";
+		case ModexAPI::CacheType::kCell:   return "Teleport";
+		case ModexAPI::CacheType::kOutfit: return "Outfit";
+		default:                           return nullptr;
+		}
+	}
+
+	ModexAPI::QueryHandle ModexInterface::CompileQuery(const ModexAPI::QuerySpec& a_spec)
+	{
+		if (!IsDataReady()) {
+			return 0;
+		}
+
+		auto* list = GetCacheList(a_spec.type);
+		const char* table = GetFilterTableID(a_spec.type);
+		if (!list || !table) {
+			return 0;
+		}
+
+		const auto searchProperty = magic_enum::enum_cast<Modex::PropertyType>(static_cast<uint32_t>(a_spec.searchProperty));
+		if (!searchProperty.has_value() || searchProperty.value() == PropertyType::kTotal) {
+			Warn("ModexInterface: Unknown search property {} in query.", static_cast<uint32_t>(a_spec.searchProperty));
+			return 0;
+		}
+
+		const SearchQuery search(a_spec.search ? a_spec.search : "");
+		const FilterProperty searchKey(searchProperty.value());
+
+		// A private FilterSystem over the table's definitions, so selecting nodes for a query
+		// never touches the menu's own filter state.
+		std::optional<FilterSystem> filters;
+		CompiledFilter filter;
+
+		if (a_spec.filterIDs && a_spec.filterCount > 0) {
+			filters.emplace(ConfigManager::FILTER_DIRECTORY / (std::string(table) + ".json"));
+
+			if (!filters->Load(false)) {
+				Warn("ModexInterface: No filter definitions for '{}', rejecting query.", table);
+				return 0;
+			}
+
+			for (uint32_t i = 0; i < a_spec.filterCount; ++i) {
+				const char* id = a_spec.filterIDs[i];
+
+				if (!id || !filters->FindNode(id)) {
+					Warn("ModexInterface: Unknown filter node '{}' in query.", id ? id : "");
+					return 0;
+				}
+
+				filters->ActivateNodeByID(id, true);
+			}
+
+			filter = filters->CompileFilter(a_spec.matchAllFilters ? FilterLogic::AND : FilterLogic::OR);
+		}
+
+		const auto plugin = ResolvePluginFilter(a_spec.filter.plugin);
+
+		auto query = std::make_shared<CompiledQuery>();
+		query->type = a_spec.type;
+
+		if (plugin) {
+			for (uint32_t i = 0; i < static_cast<uint32_t>(list->size()); ++i) {
+				const auto& obj = (*list)[i];
+
+				if (!PassesBatchFilter(obj, a_spec.filter, *plugin))
+					continue;
+
+				if (!search.Matches(&obj, searchKey))
+					continue;
+
+				if (!filter.Matches(&obj))
+					continue;
+
+				query->rows.push_back(i);
+			}
+		}
+
+		Locker locker(m_queryLock);
+
+		const ModexAPI::QueryHandle handle = m_nextQuery++;
+		if (m_nextQuery == 0) {
+			m_nextQuery = 1;
+		}
+
+		Debug("ModexInterface: Compiled query {} with {} results.", handle, query->rows.size());
+		m_queries[handle] = std::move(query);
+		return handle;
+	}
+
+	std::shared_ptr<const CompiledQuery> ModexInterface::FindQuery(ModexAPI::QueryHandle a_query)
+	{
+		Locker locker(m_queryLock);
+
+		auto it = m_queries.find(a_query);
+		return it != m_queries.end() ? it->second : nullptr;
+	}
+
+	uint32_t ModexInterface::GetQueryResultCount(ModexAPI::QueryHandle a_query)
+	{
+		const auto query = FindQuery(a_query);
+		return query ? static_cast<uint32_t>(query->rows.size()) : 0;
+	}
+
+	uint32_t ModexInterface::FetchQueryResults(ModexAPI::QueryHandle a_query, uint32_t a_offset, ModexAPI::FormBatch& a_batch)
+	{
+		a_batch.next = a_offset;
+
+		const auto query = FindQuery(a_query);
+		if (!query) {
+			return 0;
+		}
+
+		auto* list = GetCacheList(query->type);
+		if (!list) {
+			return 0;
+		}
+
+		const uint32_t total = static_cast<uint32_t>(query->rows.size());
+
+		uint32_t count = 0;
+		uint32_t index = (std::min)(a_offset, total);
+
+		for (; index < total && count < a_batch.capacity; ++index) {
+			WriteBatchRow((*list)[query->rows[index]], a_batch, count++);
+		}
+
+		a_batch.next = index;
+		return count;
+	}
+
+	void ModexInterface::ReleaseQuery(ModexAPI::QueryHandle a_query)
+	{
+		Locker locker(m_queryLock);
+		m_queries.erase(a_query);
+	}
+
+	ModexAPI::StringRef ModexInterface::GetPluginName(uint16_t a_pluginIndex)
+	{
+		auto* dataHandler = RE::TESDataHandler::GetSingleton();
+		const RE::TESFile* file = nullptr;
+
+		if (a_pluginIndex < 0xFE) {
+			file = dataHandler->LookupLoadedModByIndex(static_cast<uint8_t>(a_pluginIndex));
+		} else if (a_pluginIndex >= 0x100 && a_pluginIndex < FILE_INDEX_COUNT) {
+			file = dataHandler->LookupLoadedLightModByIndex(static_cast<uint16_t>(a_pluginIndex - 0x100));
+		}
+
+		if (!file) {
+			return {};
+		}
+
+		return { file->fileName, static_cast<uint32_t>(std::strlen(file->fileName)) };
+	}
+
 	// Specify which struct a user is requesting as API revisions may differ.
 	void* ModexInterface::GetApiFunction(unsigned int a_revisionNumber)
 	{
 		switch (a_revisionNumber) {
 		case 1:
 			return static_cast<ModexAPI::IModexInterface001*>(GetSingleton());
+		case 2:
+			return static_cast<ModexAPI::IModexInterface002*>(GetSingleton());
 		default:
 			return nullptr;
 		}
@@ -12,7 +12,9 @@ namespace Modex
 	static_assert(static_cast<uint32_t>(Modex::Ownership::All) == 7,
 		"Internal Ownership changed - update ModexAPI::CacheType to match");
 
-	class ModexInterface : public ModexAPI::IModexInterface001
+	struct CompiledQuery;
+
+	class ModexInterface : public ModexAPI::IModexInterface002
 	{
 	public:
 		static ModexInterface* GetSingleton()
@@ -65,6 +67,14 @@ namespace Modex
 		void SetDefaultOutfit(RE::FormID a_outfitFormID, RE::FormID a_targetReference) override;
 		void SetSleepOutfit(RE::FormID a_outfitFormID, RE::FormID a_targetReference) override;
 
+		uint32_t QueryBatch(ModexAPI::CacheType a_type, const ModexAPI::BatchFilter& a_filter, uint32_t a_start, ModexAPI::FormBatch& a_batch) override;
+		ModexAPI::StringRef GetPluginName(uint16_t a_pluginIndex) override;
+
+		ModexAPI::QueryHandle CompileQuery(const ModexAPI::QuerySpec& a_spec) override;
+		uint32_t GetQueryResultCount(ModexAPI::QueryHandle a_query) override;
+		uint32_t FetchQueryResults(ModexAPI::QueryHandle a_query, uint32_t a_offset, ModexAPI::FormBatch& a_batch) override;
+		void ReleaseQuery(ModexAPI::QueryHandle a_query) override;
+
 		// Called after Data::Run() completes to signal the API is ready.
 		static void SetDataReady(bool a_ready);
 
@@ -73,5 +83,11 @@ namespace Modex
 
 	private:
 		static void* GetApiFunction(unsigned int a_revisionNumber);
+
+		std::shared_ptr<const CompiledQuery> FindQuery(ModexAPI::QueryHandle a_query);
+
+		ExclusiveLock                                                                    m_queryLock;
+		std::unordered_map<ModexAPI::QueryHandle, std::shared_ptr<const CompiledQuery>> m_queries;
+		ModexAPI::QueryHandle                                                            m_nextQuery = 1;
 	};
 }
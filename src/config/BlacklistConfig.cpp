@@ -2,26 +2,43 @@
 
 namespace Modex
 {
-	void BlacklistConfig::LoadBlacklist()
+	bool BlacklistConfig::Load(bool a_create)
 	{
-		ASSERT_MSG(!Load(true), "Failed to load blacklist config!");
-
-		for (auto& [filename, nil] : m_data.items()) {
-			m_blacklist.insert(RE::TESDataHandler::GetSingleton(false)->LookupModByName(filename));
-		}
+		const bool result = ConfigManager::Load(a_create);
+		Compile();
+		return result;
 	}
-	
-	bool BlacklistConfig::Has(const RE::TESFile* a_plugin)
+
+	// Plugins listed in the config but not loaded this session are skipped; they stay in the
+	// file and are picked up again once they return to the load order.
+	void BlacklistConfig::Compile()
 	{
-		if (a_plugin == nullptr) {
-			return false;
+		m_compiled.reset();
+		m_blacklist.clear();
+
+		auto* dataHandler = RE::TESDataHandler::GetSingleton();
+		if (dataHandler == nullptr || !m_data.is_object()) {
+			return;
 		}
 
-		if (a_plugin->fileName[0] == '\0') {
-			return false;
+		for (const auto& [filename, nil] : m_data.items()) {
+			const auto* file = dataHandler->LookupModByName(filename);
+			const auto index = PackFileIndex(file);
+
+			if (index == INVALID_FILE_INDEX) {
+				continue;
+			}
+
+			m_compiled.set(index);
+			m_blacklist.insert(file);
 		}
 
-		return ConfigManager::Has(a_plugin->fileName);
+		Trace("BlacklistConfig: Compiled {} blacklisted plugins.", m_blacklist.size());
+	}
+	
+	bool BlacklistConfig::Has(const RE::TESFile* a_plugin) const
+	{
+		return Has(PackFileIndex(a_plugin));
 	}
 
 	void BlacklistConfig::AddPluginToBlacklist(const RE::TESFile* a_plugin)
@@ -36,6 +53,7 @@ namespace Modex
 
 		ConfigManager::Add(a_plugin->fileName);
 		ConfigManager::Save();
+		Compile();
 	}
 
 	void BlacklistConfig::RemovePluginFromBlacklist(const RE::TESFile* a_plugin)
@@ -50,6 +68,7 @@ namespace Modex
 
 		ConfigManager::Remove(a_plugin->fileName);
 		ConfigManager::Save();
+		Compile();
 	}
 
 	BlacklistConfig::BlacklistConfig()
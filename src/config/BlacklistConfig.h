@@ -1,6 +1,9 @@
 #pragma once
 
 #include "ConfigManager.h"
+#include "data/BaseObject.h"
+
+#include <bitset>
 
 namespace Modex
 {
@@ -10,8 +13,13 @@ namespace Modex
     class BlacklistConfig : public ConfigManager
     {
     private:
+        // Compiled from m_data whenever the blacklist changes. Indexed by PackFileIndex so
+        // per-item checks during filtering are a single bit test.
+        std::bitset<FILE_INDEX_COUNT>          m_compiled;
         std::unordered_set<const RE::TESFile*> m_blacklist;
 
+        void Compile();
+
     public:
         static inline BlacklistConfig* GetSingleton()
         {
@@ -21,9 +29,10 @@ namespace Modex
 
         BlacklistConfig();
 
-        void LoadBlacklist();
+        bool Load(bool a_create) override;
 
-        bool Has(const RE::TESFile* a_plugin);
+        [[nodiscard]] bool Has(uint16_t a_fileIndex) const { return a_fileIndex < m_compiled.size() && m_compiled.test(a_fileIndex); }
+        [[nodiscard]] bool Has(const RE::TESFile* a_plugin) const;
         void AddPluginToBlacklist(const RE::TESFile* a_plugin);
         void RemovePluginFromBlacklist(const RE::TESFile* a_plugin);
 
@@ -1,4 +1,5 @@
 #include "ConfigManager.h"
+#include "config/PersistenceService.h"
 #include "config/UserData.h"
 
 namespace Modex
@@ -8,13 +9,7 @@ namespace Modex
 	{
 		Debug("Creating new config file at '{}'", a_path.string());
 
-		std::filesystem::create_directories(a_path.parent_path());
-
-		std::ofstream file(a_path);
-		if (file.is_open()) {
-			file << a_data.dump(4);
-			file.close();
-		}
+		PersistenceService::WriteAtomic(a_path, a_data.dump(4));
 	}
 
 	// Derived classes override to provide state.
@@ -83,28 +78,16 @@ namespace Modex
 		Trace("Config file '{}' loaded successfully", m_file_path.stem().string());
 	}
 
+	// Snapshots the document and returns; the write happens later on a worker thread, so this
+	// can only report that the previous write of this file failed. Failures are also logged and
+	// shown as a notification when they happen.
 	bool ConfigManager::Save()
 	{
 		ASSERT_MSG(!m_initialized, "Attempted to save uninitialized ConfigManager Class!");
 
-		try {
-			// Create directories if they don't exist
-			if (!std::filesystem::exists(m_file_path.parent_path())) {
-				Trace("Creating directory to save Config File '{}'", m_file_path.string());
-				std::filesystem::create_directories(m_file_path.parent_path());
-			}
-
-			std::ofstream file(m_file_path);
-			if (!file.is_open()) {
-				return false;
-			}
-			file << m_data.dump(4);
-			return true;
-		} catch (...) {
-			return false;
-		}
-
-		Trace("Config file '{}' saved successfully", m_file_path.stem().string());
+		auto* persistence = PersistenceService::GetSingleton();
+		persistence->Queue(m_file_path, m_data);
+		return persistence->GetStatus(m_file_path) != PersistenceService::WriteStatus::Failed;
 	}
 
 	// Export vector of JSON keys, does not include values!
@@ -0,0 +1,160 @@
+#include "DirectoryWatcher.h"
+
+#include <fstream>
+
+namespace Modex
+{
+	DirectoryWatcher::DirectoryWatcher(std::filesystem::path a_root, std::string a_extension)
+		: m_root(std::move(a_root))
+		, m_extension(std::move(a_extension))
+	{}
+
+	// Snapshot keys go through one spelling so saved paths and scanned paths compare equal.
+	std::string DirectoryWatcher::MakeKey(const std::filesystem::path& a_path)
+	{
+		return a_path.lexically_normal().make_preferred().string();
+	}
+
+	bool DirectoryWatcher::Matches(const std::filesystem::path& a_path) const
+	{
+		return a_path.extension() == m_extension;
+	}
+
+	// FNV-1a over the file contents. Zero is reserved for unreadable files.
+	std::uint64_t DirectoryWatcher::HashFile(const std::filesystem::path& a_path)
+	{
+		std::ifstream file(a_path, std::ios::binary);
+		if (!file.is_open()) {
+			return 0;
+		}
+
+		std::uint64_t hash = 14695981039346656037ull;
+		char          buffer[4096];
+
+		while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0) {
+			const auto read = static_cast<size_t>(file.gcount());
+			for (size_t i = 0; i < read; i++) {
+				hash ^= static_cast<std::uint8_t>(buffer[i]);
+				hash *= 1099511628211ull;
+			}
+		}
+
+		return hash == 0 ? 1 : hash;
+	}
+
+	// Metadata only; hashes are filled in lazily by Poll when an entry looks different.
+	DirectoryWatcher::Snapshot DirectoryWatcher::Scan() const
+	{
+		Snapshot snapshot;
+		std::error_code ec;
+
+		if (!std::filesystem::is_directory(m_root, ec)) {
+			return snapshot;
+		}
+
+		auto it = std::filesystem::recursive_directory_iterator(m_root, std::filesystem::directory_options::skip_permission_denied, ec);
+		for (; !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec)) {
+			if (!it->is_regular_file(ec) || !Matches(it->path())) {
+				continue;
+			}
+
+			FileState state;
+			state.mtime = it->last_write_time(ec);
+			state.size = it->file_size(ec);
+
+			if (!ec) {
+				snapshot.emplace(MakeKey(it->path()), state);
+			}
+
+			ec.clear();
+		}
+
+		return snapshot;
+	}
+
+	void DirectoryWatcher::Reset()
+	{
+		auto snapshot = Scan();
+
+		Locker locker(m_lock);
+		m_snapshot = std::move(snapshot);
+	}
+
+	DirectoryWatcher::Changes DirectoryWatcher::Poll()
+	{
+		auto current = Scan();
+		Changes changes;
+
+		Locker locker(m_lock);
+
+		for (auto& [key, state] : current) {
+			const auto it = m_snapshot.find(key);
+
+			if (it == m_snapshot.end()) {
+				changes.added.emplace_back(key);
+				continue;
+			}
+
+			const auto& previous = it->second;
+
+			if (previous.mtime == state.mtime && previous.size == state.size) {
+				state = previous;
+				continue;
+			}
+
+			// Editors and sync tools often rewrite identical bytes; only a content change counts.
+			state.hash = HashFile(key);
+			state.hashed = true;
+
+			if (!previous.hashed || previous.hash != state.hash) {
+				changes.modified.emplace_back(key);
+			}
+		}
+
+		for (const auto& [key, state] : m_snapshot) {
+			if (!current.contains(key)) {
+				changes.removed.emplace_back(key);
+			}
+		}
+
+		m_snapshot = std::move(current);
+		return changes;
+	}
+
+	void DirectoryWatcher::Track(const std::filesystem::path& a_path)
+	{
+		std::error_code ec;
+
+		FileState state;
+		state.mtime = std::filesystem::last_write_time(a_path, ec);
+		state.size = std::filesystem::file_size(a_path, ec);
+		state.hash = HashFile(a_path);
+		state.hashed = state.hash != 0;
+
+		if (ec) {
+			return Forget(a_path);
+		}
+
+		Locker locker(m_lock);
+		m_snapshot[MakeKey(a_path)] = state;
+	}
+
+	void DirectoryWatcher::Seed(const std::filesystem::path& a_path, std::uint64_t a_hash)
+	{
+		if (a_hash == 0) {
+			return;
+		}
+
+		Locker locker(m_lock);
+		if (auto it = m_snapshot.find(MakeKey(a_path)); it != m_snapshot.end()) {
+			it->second.hash = a_hash;
+			it->second.hashed = true;
+		}
+	}
+
+	void DirectoryWatcher::Forget(const std::filesystem::path& a_path)
+	{
+		Locker locker(m_lock);
+		m_snapshot.erase(MakeKey(a_path));
+	}
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <filesystem>
+
+namespace Modex
+{
+	// Polling change detector for a directory tree. Poll() compares a fresh scan against the last
+	// snapshot using mtime and size, and only hashes files whose metadata moved, so a touched but
+	// unchanged file is not reported. Plain std::filesystem only; no engine calls, safe on workers.
+	class DirectoryWatcher
+	{
+	public:
+		struct FileState
+		{
+			std::filesystem::file_time_type mtime{};
+			std::uintmax_t                  size = 0;
+			std::uint64_t                   hash = 0;
+			bool                            hashed = false;
+		};
+
+		struct Changes
+		{
+			std::vector<std::filesystem::path> added;
+			std::vector<std::filesystem::path> modified;
+			std::vector<std::filesystem::path> removed;
+
+			bool empty() const { return added.empty() && modified.empty() && removed.empty(); }
+		};
+
+		DirectoryWatcher(std::filesystem::path a_root, std::string a_extension);
+
+		Changes Poll();
+		void    Reset();
+
+		// Refresh or drop a single entry after writing it ourselves, so our own saves are not
+		// reported back as external changes.
+		void Track(const std::filesystem::path& a_path);
+		void Forget(const std::filesystem::path& a_path);
+
+		// Gives a baseline entry the hash of the contents that were loaded, so a later touch or
+		// identical rewrite compares equal instead of being reported as modified.
+		void Seed(const std::filesystem::path& a_path, std::uint64_t a_hash);
+
+		static std::uint64_t HashFile(const std::filesystem::path& a_path);
+
+	private:
+		using Snapshot = std::unordered_map<std::string, FileState>;
+
+		static std::string MakeKey(const std::filesystem::path& a_path);
+
+		Snapshot Scan() const;
+		bool     Matches(const std::filesystem::path& a_path) const;
+
+		const std::filesystem::path m_root;
+		const std::string           m_extension;
+
+		ExclusiveLock               m_lock;
+		Snapshot                    m_snapshot;
+	};
+}
@@ -1,35 +1,32 @@
 #include "EquipmentConfig.h"
+#include "config/PersistenceService.h"
 #include "config/UserData.h"
 #include "core/Commands.h"
+#include "core/WorkerPool.h"
 #include "data/BaseObject.h"
 
-// TODO: Migrate to caching all kits on startup by default for quicker lookups.
-
 namespace Modex
 {
-	// Helper to open and parse JSON file.
-	nlohmann::json OpenJSON(const std::filesystem::path& a_path)
+	namespace
 	{
-		nlohmann::json data;
-		if (!std::filesystem::exists(a_path)) {
-			Warn("JSON file does not exist: '{}'", a_path.stem().string());
-			return nlohmann::json::object();
-		}
+		// Builds the metadata for a kit file from its location under the kits directory.
+		std::optional<KitData> MakeMetadata(const std::filesystem::path& a_fullPath)
+		{
+			auto relativePath = a_fullPath.lexically_relative(EQUIPMENT_JSON_PATH);
+			auto parentPath = relativePath.parent_path();
 
-		try {
-			std::ifstream file(a_path);
+			// Validate the relative path doesn't escape. Otherwise our m_key will be invalid
+			// annd result in weird behavior when renaming, copying, and saving.
 
-			if (!file.is_open()) {
-				Error("Could not open JSON file: '{}'", a_path.stem().string());
-				return nlohmann::json::object();
+			if (relativePath.empty() || relativePath.string().starts_with("..")) {
+				return std::nullopt;
 			}
 
-			file >> data;
-			Trace("Successfully opened JSON file: '{}'", a_path.stem().string());
-			return data;
-		} catch (...) {
-			ASSERT_MSG(true, "Failed to open JSON file: '{}'", a_path.stem().string());
-			return nlohmann::json::object();
+			KitData metadata;
+			metadata.m_filepath = a_fullPath.string();
+			metadata.m_key = relativePath.string();
+			metadata.m_collection = parentPath.empty() ? "" : parentPath.string();
+			return metadata;
 		}
 	}
 
@@ -67,8 +64,17 @@ namespace Modex
 			std::filesystem::create_directory(EQUIPMENT_JSON_PATH);
 		}
 
-		auto& cache = GetSingleton()->m_cache;
+		auto* self = GetSingleton();
+		auto& cache = self->m_cache;
 		cache.clear();
+		self->m_kits.clear();
+		self->m_kitsByForm.clear();
+		self->m_kitsByPlugin.clear();
+		self->m_sortedDirty = true;
+
+		// Baseline for the directory watcher, taken before parsing so anything written while the
+		// kits load still shows up as changed on the next poll.
+		self->m_watcher.Reset();
 
 		int loaded_count = 0;
 		for (auto& entry : std::filesystem::recursive_directory_iterator(EQUIPMENT_JSON_PATH)) {
@@ -76,26 +82,14 @@ namespace Modex
 				continue;
 			}
 
-			auto relativePath = entry.path().lexically_relative(EQUIPMENT_JSON_PATH);
-			auto parentPath = relativePath.parent_path();
+			auto entryMetadata = MakeMetadata(entry.path());
 
-			// Validate the relative path doesn't escape. Otherwise our m_key will be invalid
-			// annd result in weird behavior when renaming, copying, and saving.
-
-			if (relativePath.string().starts_with("..")) {
+			if (!entryMetadata.has_value()) {
 				Trace("  Skipping file outside base path: '{}'", entry.path().string());
 				continue;
 			}
 
-			KitData metadata;
-			metadata.m_filepath = entry.path().string();
-			metadata.m_key = relativePath.string();
-			
-			if (parentPath.empty()) {
-				metadata.m_collection = "";
-			} else {
-				metadata.m_collection = parentPath.string();
-			}
+			const auto& metadata = entryMetadata.value();
 			
 			// Cache metadata as KitData
 			cache[metadata.m_key] = metadata;
@@ -105,9 +99,360 @@ namespace Modex
 		}
 		
 		Debug("Loaded {} kits metadata from '{}'", cache.size(), EQUIPMENT_JSON_PATH.string());
+
+		// Kit files are independent, so parsing is spread over the worker pool. Form lookups
+		// stay on this thread once every file has been parsed. Each job also hashes its file to
+		// seed the watcher's baseline.
+		struct ParseResult
+		{
+			std::string           key;
+			std::filesystem::path path;
+			std::optional<Kit>    kit;
+			std::string           error;
+			std::uint64_t         hash = 0;
+		};
+
+		std::vector<std::future<ParseResult>> jobs;
+		jobs.reserve(cache.size());
+
+		for (const auto& [key, metadata] : cache) {
+			jobs.push_back(WorkerPool::GetSingleton()->Submit([key, path = metadata.m_filepath]() {
+				ParseResult result{ key, path };
+				result.hash = DirectoryWatcher::HashFile(path);
+				result.kit = ParseKit(path, result.error);
+				return result;
+			}));
+		}
+
+		for (auto& job : jobs) {
+			auto result = job.get();
+			self->m_watcher.Seed(result.path, result.hash);
+
+			if (!result.kit.has_value()) {
+				Warn("  Failed to parse kit '{}': {}", result.key, result.error);
+				continue;
+			}
+
+			auto& kit = result.kit.value();
+			kit.m_key = result.key;
+			ResolveItems(kit);
+			self->PutKit(std::move(kit));
+		}
+
+		Debug("Parsed {}/{} kits into memory", self->m_kits.size(), cache.size());
+
+		self->m_lastPoll = std::chrono::steady_clock::now();
 		return true;
 	}
 
+	// Called once per frame. While the menu is open, the kits directory is polled on the worker
+	// pool every POLL_INTERVAL and only the kits that changed on disk are parsed again.
+	void EquipmentConfig::Update(bool a_active)
+	{
+		auto* self = GetSingleton();
+
+		if (!a_active || self->m_polling) {
+			return;
+		}
+
+		const auto now = std::chrono::steady_clock::now();
+		if (now - self->m_lastPoll < POLL_INTERVAL) {
+			return;
+		}
+
+		self->m_lastPoll = now;
+		self->m_polling = true;
+
+		WorkerPool::GetSingleton()->Dispatch(CancelToken(),
+			[self](const CancelToken&) {
+				ExternalChanges result;
+				result.changes = self->m_watcher.Poll();
+
+				for (const auto* list : { &result.changes.added, &result.changes.modified }) {
+					for (const auto& path : *list) {
+						std::string error;
+						auto kit = ParseKit(path, error);
+						result.parsed.emplace_back(path, std::move(kit), std::move(error));
+					}
+				}
+
+				return result;
+			},
+			[self](ExternalChanges a_result) {
+				self->m_polling = false;
+				ApplyExternalChanges(a_result);
+			});
+	}
+
+	// Runs on the main thread with kits already parsed by the worker.
+	void EquipmentConfig::ApplyExternalChanges(ExternalChanges& a_result)
+	{
+		if (a_result.changes.empty()) {
+			return;
+		}
+
+		auto* self = GetSingleton();
+		size_t applied = 0;
+
+		for (const auto& path : a_result.changes.removed) {
+			// A poll that raced with one of our own saves can report a file that is back already.
+			if (std::filesystem::exists(path)) {
+				continue;
+			}
+
+			if (auto metadata = MakeMetadata(path); metadata.has_value() && self->m_cache.contains(metadata->m_key)) {
+				Debug("Kit removed outside of Modex: '{}'", metadata->m_key);
+				EraseKit(metadata->m_key);
+				applied++;
+			}
+		}
+
+		for (auto& [path, kit, error] : a_result.parsed) {
+			auto metadata = MakeMetadata(path);
+			if (!metadata.has_value()) {
+				continue;
+			}
+
+			if (!kit.has_value()) {
+				Warn("Failed to re-parse changed kit '{}': {}", metadata->m_key, error);
+				continue;
+			}
+
+			kit->m_key = metadata->m_key;
+			kit->m_filepath = metadata->m_filepath;
+			ResolveItems(kit.value());
+
+			if (!self->m_cache.contains(metadata->m_key)) {
+				self->m_sortedDirty = true;
+			}
+
+			self->m_cache[metadata->m_key] = metadata.value();
+			self->PutKit(std::move(kit.value()));
+			applied++;
+
+			Debug("Kit changed outside of Modex: '{}'", metadata->m_key);
+		}
+
+		if (applied > 0) {
+			self->m_epoch.fetch_add(1, std::memory_order_relaxed);
+			Info("Re-indexed {} kits changed on disk", applied);
+		}
+	}
+
+	// Parses a kit file without touching the engine; safe to call from worker threads.
+	std::optional<Kit> EquipmentConfig::ParseKit(const std::filesystem::path& a_fullPath, std::string& a_error)
+	{
+		nlohmann::json JSON;
+
+		try {
+			std::ifstream file(a_fullPath);
+
+			if (!file.is_open()) {
+				a_error = "could not open file";
+				return std::nullopt;
+			}
+
+			file >> JSON;
+		} catch (const std::exception& e) {
+			a_error = e.what();
+			return std::nullopt;
+		}
+
+		if (!JSON.is_object() || JSON.size() != 1) {
+			a_error = std::format("expected exactly 1 kit in file, found {}", JSON.size());
+			return std::nullopt;
+		}
+
+		const auto& kit_data = JSON.items().begin().value();
+
+		Kit new_kit;
+		new_kit.m_filepath = a_fullPath;
+		new_kit.m_key = std::filesystem::path(a_fullPath).lexically_relative(EQUIPMENT_JSON_PATH).string();
+		new_kit.m_collection = kit_data.value("Collection", "");
+		new_kit.m_desc = kit_data.value("Description", "No description.");
+		new_kit.m_tableID = 0;
+
+		if (kit_data.contains("Items") && kit_data["Items"].is_object()) {
+			new_kit.m_items.reserve(kit_data["Items"].size());
+
+			for (auto& [editorid, item_data] : kit_data["Items"].items()) {
+				KitItem item;
+				item.m_editorid = KitStringPool::Intern(editorid);
+				item.m_plugin = KitStringPool::Intern(item_data.value("Plugin", ""));
+				item.m_name = KitStringPool::Intern(item_data.value("Name", ""));
+				item.m_amount = item_data.value("Amount", 1);
+				item.m_equipped = item_data.value("Equipped", false);
+
+				new_kit.m_items.push_back(item);
+			}
+		}
+
+		return new_kit;
+	}
+
+	// Resolves each item's EditorID to a FormID once, so later lookups are by ID.
+	void EquipmentConfig::ResolveItems(Kit& a_kit)
+	{
+		for (auto& item : a_kit.m_items) {
+			item.Resolve();
+		}
+	}
+
+	// Keeps the metadata and in-memory copies of a kit in step.
+	void EquipmentConfig::StoreKit(const Kit& a_kit)
+	{
+		auto* self = GetSingleton();
+
+		if (!self->m_cache.contains(a_kit.m_key)) {
+			self->m_sortedDirty = true;
+		}
+
+		self->m_cache[a_kit.m_key] = a_kit;
+
+		Kit stored = a_kit;
+		stored.m_tableID = 0;
+		ResolveItems(stored);
+		self->PutKit(std::move(stored));
+	}
+
+	void EquipmentConfig::EraseKit(const std::string& a_key)
+	{
+		auto* self = GetSingleton();
+
+		if (auto it = self->m_kits.find(a_key); it != self->m_kits.end()) {
+			self->UnindexKit(it->second);
+			self->m_kits.erase(it);
+		}
+
+		self->m_cache.erase(a_key);
+		self->m_sortedDirty = true;
+	}
+
+	// Replaces the in-memory kit under its key and moves its index entries along with it.
+	void EquipmentConfig::PutKit(Kit&& a_kit)
+	{
+		if (auto it = m_kits.find(a_kit.m_key); it != m_kits.end()) {
+			UnindexKit(it->second);
+		}
+
+		IndexKit(a_kit);
+
+		const auto key = a_kit.m_key;
+		m_kits[key] = std::move(a_kit);
+	}
+
+	std::string EquipmentConfig::NormalizePluginName(std::string_view a_plugin)
+	{
+		std::string name(a_plugin);
+		std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+		return name;
+	}
+
+	void EquipmentConfig::IndexKit(const Kit& a_kit)
+	{
+		for (const auto& item : a_kit.m_items) {
+			if (item.m_formID != 0) {
+				m_kitsByForm[item.m_formID].insert(a_kit.m_key);
+			}
+
+			if (item.m_plugin != 0) {
+				m_kitsByPlugin[KitStringPool::Intern(NormalizePluginName(item.GetPlugin()))].insert(a_kit.m_key);
+			}
+		}
+
+		m_pluginsDirty = true;
+		m_revision.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	void EquipmentConfig::UnindexKit(const Kit& a_kit)
+	{
+		const auto erase = [&a_kit](auto& a_index, auto a_id) {
+			if (auto it = a_index.find(a_id); it != a_index.end()) {
+				it->second.erase(a_kit.m_key);
+
+				if (it->second.empty()) {
+					a_index.erase(it);
+				}
+			}
+		};
+
+		for (const auto& item : a_kit.m_items) {
+			erase(m_kitsByForm, item.m_formID);
+
+			if (item.m_plugin != 0) {
+				erase(m_kitsByPlugin, KitStringPool::Find(NormalizePluginName(item.GetPlugin())));
+			}
+		}
+
+		m_pluginsDirty = true;
+		m_revision.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	// Number of kits containing a form, for the "used in N kits" badge.
+	size_t EquipmentConfig::GetKitCountWithForm(RE::FormID a_formID)
+	{
+		const auto& index = GetSingleton()->m_kitsByForm;
+		const auto it = index.find(a_formID);
+		return it != index.end() ? it->second.size() : 0;
+	}
+
+	// Returns sorted keys of every kit containing the given form.
+	std::vector<std::string> EquipmentConfig::FindKitsWithForm(RE::FormID a_formID)
+	{
+		const auto& index = GetSingleton()->m_kitsByForm;
+		std::vector<std::string> keys;
+
+		if (auto it = index.find(a_formID); it != index.end()) {
+			keys.assign(it->second.begin(), it->second.end());
+			std::sort(keys.begin(), keys.end());
+		}
+
+		return keys;
+	}
+
+	// Returns sorted keys of every kit with at least one item from the given plugin. The plugin
+	// name is matched case-insensitively.
+	std::vector<std::string> EquipmentConfig::FindKitsWithPlugin(std::string_view a_plugin)
+	{
+		const auto& index = GetSingleton()->m_kitsByPlugin;
+		std::vector<std::string> keys;
+
+		if (const auto id = KitStringPool::Find(NormalizePluginName(a_plugin)); id != 0) {
+			if (auto it = index.find(id); it != index.end()) {
+				keys.assign(it->second.begin(), it->second.end());
+				std::sort(keys.begin(), keys.end());
+			}
+		}
+
+		return keys;
+	}
+
+	// Loaded plugins, in load order, that at least one kit draws items from. Feeds the kit
+	// browser's plugin filter; rebuilt lazily after kits are indexed or unindexed.
+	const std::vector<std::string>& EquipmentConfig::GetKitPlugins()
+	{
+		auto* self = GetSingleton();
+
+		if (self->m_pluginsDirty) {
+			self->m_sortedPlugins.clear();
+
+			if (auto dataHandler = RE::TESDataHandler::GetSingleton()) {
+				for (const auto* file : dataHandler->files) {
+					if (!file) continue;
+
+					const auto name = file->GetFilename();
+					if (const auto id = KitStringPool::Find(NormalizePluginName(name)); id != 0 && self->m_kitsByPlugin.contains(id)) {
+						self->m_sortedPlugins.emplace_back(name);
+					}
+				}
+			}
+
+			self->m_pluginsDirty = false;
+		}
+
+		return self->m_sortedPlugins;
+	}
+
 	// Create a new kit with a given relative path (key). Returns a Kit object on success.
 	std::optional<Kit> EquipmentConfig::CreateKit(const std::filesystem::path& a_relativePath)
 	{
@@ -135,22 +480,23 @@ namespace Modex
 			return std::nullopt;
 		}
 
-		auto& cache = GetSingleton()->m_cache;
-		cache[data.m_key] = data;
-
 		UserData::SendEvent(ModexActionType::CreateKit, data.m_key, Ownership::Kit);
 
 		Info("Created new kit: '{}'", data.m_key);
 		return data;
 	}
 
-	// Query runtime cache and load kit if metadata is found already.
+	// Query runtime cache and return the in-memory kit, falling back to disk if it failed to parse on load.
 	std::optional<Kit> EquipmentConfig::LoadKit(const KitData& a_metadata)
 	{
 		Debug("Loading kit from cache: '{}'", a_metadata.m_key);
 
-		auto& cache = GetSingleton()->m_cache;
-		if (cache.find(a_metadata.m_key) != cache.end()) {
+		auto* self = GetSingleton();
+		if (auto it = self->m_kits.find(a_metadata.m_key); it != self->m_kits.end()) {
+			return it->second;
+		}
+
+		if (self->m_cache.contains(a_metadata.m_key)) {
 			return LoadKit(a_metadata.m_filepath);
 		}
 
@@ -163,41 +509,16 @@ namespace Modex
 	{
 		Debug("Loading kit from JSON file: '{}'", a_fullPath.string());
 
-		auto JSON = OpenJSON(a_fullPath);
-		if (JSON.is_null() || JSON.empty()) {
-			ASSERT_MSG(true, "Failed to read or parse JSON kit: {}", a_fullPath.string());
-			return std::nullopt;
-		}
-
-		if (JSON.size() != 1) {
-			ASSERT_MSG(true, "Expected exactly 1 kit in file, found {}:  {}", JSON.size(), a_fullPath.string());
+		std::string error;
+		auto new_kit = ParseKit(a_fullPath, error);
+		if (!new_kit.has_value()) {
+			ASSERT_MSG(true, "Failed to read or parse JSON kit: {}\n\n{}", a_fullPath.string(), error);
 			return std::nullopt;
 		}
 
-		auto kit_entry = JSON.items().begin();
-		const auto& kit_data = kit_entry.value();
-
-		Kit new_kit;
-		new_kit.m_filepath = a_fullPath.string();
-		new_kit.m_key = std::filesystem::relative(a_fullPath, EQUIPMENT_JSON_PATH).string();
-		new_kit.m_collection = kit_data.value("Collection", "");
-		new_kit.m_desc = kit_data.value("Description", "No description.");
-		new_kit.m_tableID = 0;
-
-		if (kit_data.contains("Items") && kit_data["Items"].is_object()) {
-			for (auto& [editorid, item_data] : kit_data["Items"].items()) {
-				auto item = std::make_shared<KitItem>();
-				item->m_editorid = editorid;
-				item->m_plugin = item_data.value("Plugin", "");
-				item->m_name = item_data.value("Name", "");
-				item->m_amount = item_data.value("Amount", 1);
-				item->m_equipped = item_data.value("Equipped", false);
-
-				new_kit.m_items.emplace_back(item);
-			}
-		}
+		ResolveItems(new_kit.value());
 
-		Info("Loaded Kit: '{}' with {} items", new_kit.m_key, new_kit.m_items.size());
+		Info("Loaded Kit: '{}' with {} items", new_kit->m_key, new_kit->m_items.size());
 		return new_kit;
 	}
 
@@ -218,27 +539,25 @@ namespace Modex
 			data[json_key]["Items"] = nlohmann::json::object();
 		} else {
 			for (auto& item : a_kit.m_items) {
-				data[json_key]["Items"][item->m_editorid] = {
-					{ "Plugin", item->m_plugin },
-					{ "Name", item->m_name },
-					{ "Amount", item->m_amount },
-					{ "Equipped", item->m_equipped }
+				data[json_key]["Items"][std::string(item.GetEditorID())] = {
+					{ "Plugin", std::string(item.GetPlugin()) },
+					{ "Name", std::string(item.GetName()) },
+					{ "Amount", item.m_amount },
+					{ "Equipped", item.m_equipped }
 				};
 			}
 		}
 
-		try {
-			std::ofstream file(a_kit.m_filepath);
-			if (!file.is_open()) {
-				return Error("  Could not open JSON file for writing: '{}'", a_kit.m_filepath.string());
-			}
-
-			file << data.dump(4);
-			Info("Saved kit '{}' to file", a_kit.m_key);
-			return true;
-		} catch (const std::exception& e) {
-			return Error("  Exception occurred while saving kit: '{}'\n\n{}", a_kit.m_filepath.string(), e.what());
+		// Written synchronously: rename and delete remove files right after saving, so a
+		// deferred write could resurrect a kit that no longer exists.
+		if (!PersistenceService::WriteAtomic(a_kit.m_filepath, data.dump(4))) {
+			return Error("  Could not write JSON file: '{}'", a_kit.m_filepath.string());
 		}
+
+		GetSingleton()->m_watcher.Track(a_kit.m_filepath);
+		StoreKit(a_kit);
+		Info("Saved kit '{}' to file", a_kit.m_key);
+		return true;
 	}
 
 	// Duplicate and Save an existing kit, returns the new Kit object on success.
@@ -269,9 +588,6 @@ namespace Modex
 			return std::nullopt;
 		}
 
-		auto& cache = GetSingleton()->m_cache;
-		cache[new_kit.m_key] = new_kit;
-
 		UserData::SendEvent(ModexActionType::CopyKit, new_kit.m_key, Ownership::Kit);
 		Info("Copied kit '{}' to new kit '{}'", a_kit.m_key, new_kit.m_key);
 		return new_kit;
@@ -319,10 +635,8 @@ namespace Modex
 			}
 			
 			std::filesystem::remove(oldPath);
-			
-			auto& cache = GetSingleton()->m_cache;
-			cache.erase(old_key);
-			cache[new_key] = new_kit;
+			GetSingleton()->m_watcher.Forget(oldPath);
+			EraseKit(old_key);
 			
 			UserData::SendEvent(ModexActionType::RenameKit, new_key, Ownership::Kit);
 			Info("Successfully renamed kit '{}' to '{}'", old_key, new_key);
@@ -350,12 +664,14 @@ namespace Modex
 			if (std::filesystem::exists(kit_path)) {
 				std::filesystem::remove(kit_path);
 			}
+
+			GetSingleton()->m_watcher.Forget(kit_path);
 		} catch (const std::exception& e) {
 			ASSERT_MSG(true, "Failed to delete kit JSON file: {}\n\n{}", kit_path.string(), e.what());
 			return;
 		}
 		
-		cache.erase(a_kit.m_key);
+		EraseKit(a_kit.m_key);
 		UserData::SendEvent(ModexActionType::DeleteKit, a_kit.m_key, Ownership::Kit);
 		Info("Deleted kit: {}", a_kit.m_key);
 	}
@@ -375,7 +691,7 @@ namespace Modex
 
 		Trace("  Found kit metadata in cache: '{}'", a_key);
 				
-		if (auto kit = GetSingleton()->LoadKit(it->second.m_filepath); kit.has_value()) {
+		if (auto kit = LoadKit(it->second); kit.has_value()) {
 			return kit;
 		}
 		
@@ -390,51 +706,78 @@ namespace Modex
 
 		std::vector<BaseObject> items;
 		
-		for (auto& kitItem : a_kit.m_items) {
-			RE::TESForm* form = RE::TESForm::LookupByEditorID(kitItem->m_editorid);
+		items.reserve(a_kit.m_items.size());
+		
+		for (const auto& kitItem : a_kit.m_items) {
+			RE::TESForm* form = kitItem.GetForm();
 
 			if (form) {
 				items.push_back(BaseObject(form, Ownership::Kit, 0));
 			} else {
-				items.push_back(BaseObject(kitItem->m_name, kitItem->m_editorid, kitItem->m_plugin, Ownership::Kit, 0));
+				items.push_back(BaseObject(std::string(kitItem.GetName()), std::string(kitItem.GetEditorID()), std::string(kitItem.GetPlugin()), Ownership::Kit, 0));
 			}
 		}
 		
 		return items;
 	}
 
+	// Returns items of an in-memory kit by its metadata.
+	std::vector<BaseObject> EquipmentConfig::GetItems(const KitData& a_metadata)
+	{
+		auto* self = GetSingleton();
+		if (auto it = self->m_kits.find(a_metadata.m_key); it != self->m_kits.end()) {
+			return GetItems(it->second);
+		}
+
+		if (auto kit = LoadKit(a_metadata); kit.has_value()) {
+			return GetItems(kit.value());
+		}
+
+		return {};
+	}
+
 	// Returns reference to the runtime equipment list cache. vector<std::string, KitData>
 	std::unordered_map<std::string, KitData>& EquipmentConfig::GetEquipmentList()
 	{
 		return GetSingleton()->m_cache;
 	}
 
-	// Returns sorted list of equipment keys as vector<string>
-	std::vector<std::string> EquipmentConfig::GetEquipmentListSortedKeys()
+	// Rebuilds both sorted views at most once per change to the kit list.
+	void EquipmentConfig::RebuildSortedLists()
 	{
-		auto& cache = GetSingleton()->m_cache;
-		std::vector<std::string> keys;
-		
-		for (const auto& [key, data] : cache) {
-			keys.push_back(key);
+		if (!m_sortedDirty) {
+			return;
 		}
-		
-		std::sort(keys.begin(), keys.end());
-		return keys;
+
+		m_sortedKeys.clear();
+		m_sortedTails.clear();
+		m_sortedKeys.reserve(m_cache.size());
+		m_sortedTails.reserve(m_cache.size());
+
+		for (const auto& [key, data] : m_cache) {
+			m_sortedKeys.push_back(key);
+			m_sortedTails.push_back(data.GetNameTail());
+		}
+
+		std::sort(m_sortedKeys.begin(), m_sortedKeys.end());
+		std::sort(m_sortedTails.begin(), m_sortedTails.end());
+		m_sortedDirty = false;
+	}
+
+	// Returns sorted list of equipment keys as vector<string>
+	const std::vector<std::string>& EquipmentConfig::GetEquipmentListSortedKeys()
+	{
+		auto* self = GetSingleton();
+		self->RebuildSortedLists();
+		return self->m_sortedKeys;
 	}
 
 	// Returns sorted list of equipment tails as vector<string>
-	std::vector<std::string> EquipmentConfig::GetEquipmentListSortedTails()
+	const std::vector<std::string>& EquipmentConfig::GetEquipmentListSortedTails()
 	{
-		auto& cache = GetSingleton()->m_cache;
-		std::vector<std::string> tails;
-		
-		for (const auto& [key, data] : cache) {
-			tails.push_back(data.GetNameTail());
-		}
-		
-		std::sort(tails.begin(), tails.end());
-		return tails;
+		auto* self = GetSingleton();
+		self->RebuildSortedLists();
+		return self->m_sortedTails;
 	}
 
 	// Helper method to create a kit from a pre-existing outfit form.
@@ -461,15 +804,16 @@ namespace Modex
 	}
 
 	// This probably doesn't belong here.
-	std::shared_ptr<KitItem> EquipmentConfig::CreateKitItem(const BaseObject& a_item)
+	KitItem EquipmentConfig::CreateKitItem(const BaseObject& a_item)
 	{
-		auto new_item = std::make_shared<KitItem>();
+		KitItem new_item;
 		
-		new_item->m_plugin 	= a_item.GetPluginName();
-		new_item->m_name 		= a_item.GetName();
-		new_item->m_editorid 	= a_item.GetEditorID();
-		new_item->m_amount 	= a_item.GetQuantity();
-		new_item->m_equipped 	= a_item.GetEquipped();
+		new_item.m_plugin 		= KitStringPool::Intern(a_item.GetPluginName());
+		new_item.m_name 		= KitStringPool::Intern(a_item.GetName());
+		new_item.m_editorid 	= KitStringPool::Intern(a_item.GetEditorID());
+		new_item.m_amount 		= a_item.GetQuantity();
+		new_item.m_equipped 	= a_item.GetEquipped();
+		new_item.m_formID 		= a_item.IsDummy() ? 0 : a_item.GetBaseFormID();
 		
 		return new_item;
 	}
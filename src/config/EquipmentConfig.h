@@ -2,6 +2,7 @@
 
 #include "data/BaseObject.h"
 #include "config/ConfigManager.h"
+#include "config/DirectoryWatcher.h"
 
 namespace Modex
 {
@@ -12,6 +13,46 @@ namespace Modex
 	{
 	private:
 		std::unordered_map<std::string, KitData> m_cache; // filepath, data
+		std::unordered_map<std::string, Kit>     m_kits;  // key, parsed kit
+
+		// Sorted views for the kit dropdowns, rebuilt lazily after the kit list changes.
+		std::vector<std::string>                 m_sortedKeys;
+		std::vector<std::string>                 m_sortedTails;
+		bool                                     m_sortedDirty = true;
+
+		// Change detection for kits edited outside the game.
+		struct ExternalChanges
+		{
+			DirectoryWatcher::Changes                                                 changes;
+			std::vector<std::tuple<std::filesystem::path, std::optional<Kit>, std::string>> parsed;
+		};
+
+		DirectoryWatcher                         m_watcher{ EQUIPMENT_JSON_PATH, ".json" };
+		std::chrono::steady_clock::time_point    m_lastPoll{};
+		bool                                     m_polling = false;
+		std::atomic<uint32_t>                    m_epoch{ 0 };
+
+		static void               ApplyExternalChanges(ExternalChanges& a_result);
+
+		// Inverted index over the in-memory kits: which kits contain a form or use a plugin.
+		// Plugins are keyed by their lower-cased name, since hand-edited kits don't agree on case.
+		std::unordered_map<RE::FormID, std::unordered_set<std::string>> m_kitsByForm;
+		std::unordered_map<uint32_t, std::unordered_set<std::string>>   m_kitsByPlugin; // KitStringPool index
+		std::vector<std::string>                                        m_sortedPlugins;
+		bool                                                            m_pluginsDirty = true;
+		std::atomic<uint32_t>                                           m_revision{ 0 };
+
+		static std::string        NormalizePluginName(std::string_view a_plugin);
+
+		void                      PutKit(Kit&& a_kit);
+		void                      IndexKit(const Kit& a_kit);
+		void                      UnindexKit(const Kit& a_kit);
+
+		static std::optional<Kit> ParseKit(const std::filesystem::path& a_fullPath, std::string& a_error);
+		static void               ResolveItems(Kit& a_kit);
+		static void               StoreKit(const Kit& a_kit);
+		static void               EraseKit(const std::string& a_key);
+		void                      RebuildSortedLists();
 
 	public:
 		static inline EquipmentConfig* GetSingleton()
@@ -20,7 +61,17 @@ namespace Modex
 			return std::addressof(singleton);
 		}
 
+		static constexpr std::chrono::milliseconds POLL_INTERVAL{ 2000 };
+
 		static bool Load();
+		static void Update(bool a_active);
+
+		// Bumped whenever kits are re-indexed because they changed on disk outside of Modex.
+		static uint32_t GetEpoch() { return GetSingleton()->m_epoch.load(std::memory_order_relaxed); }
+
+		// Bumped whenever a kit is indexed or unindexed, whether the change came from Modex or disk.
+		static uint32_t GetRevision() { return GetSingleton()->m_revision.load(std::memory_order_relaxed); }
+
 		static bool ValidateKeyName(const std::string& a_keyName);
 
 		static std::optional<Kit> LoadKit(const KitData& a_metadata);
@@ -36,11 +87,15 @@ namespace Modex
 		static std::vector<BaseObject> 	GetItems(const Kit& a_kit); // deprecated?
 		static std::vector<BaseObject> 	GetItems(const KitData& a_metadata); // deprecated?
 		static std::optional<Kit> 		KitLookup(const std::string& a_name);
-		static std::shared_ptr<KitItem> CreateKitItem(const BaseObject& a_object);
+		static size_t                   GetKitCountWithForm(RE::FormID a_formID);
+		static std::vector<std::string> FindKitsWithForm(RE::FormID a_formID);
+		static std::vector<std::string> FindKitsWithPlugin(std::string_view a_plugin);
+		static const std::vector<std::string>& GetKitPlugins();
+		static KitItem                  CreateKitItem(const BaseObject& a_object);
 		static bool                     CreateKitFromOutfit(const std::string& a_name, RE::BGSOutfit* a_outfit, uint16_t a_level = 0);
 
-		static std::vector<std::string> GetEquipmentListSortedKeys();
-		static std::vector<std::string> GetEquipmentListSortedTails();
+		static const std::vector<std::string>& GetEquipmentListSortedKeys();
+		static const std::vector<std::string>& GetEquipmentListSortedTails();
 		static std::unordered_map<std::string, KitData>& GetEquipmentList();
 
 		static KitData At(const std::string& a_key) {
@@ -0,0 +1,179 @@
+#include "PersistenceService.h"
+
+#include <fstream>
+
+#include "core/WorkerPool.h"
+#include "ui/components/UINotification.h"
+
+namespace Modex
+{
+	bool PersistenceService::WriteAtomic(const std::filesystem::path& a_path, const std::string& a_contents)
+	{
+		try {
+			if (a_path.has_parent_path() && !std::filesystem::exists(a_path.parent_path())) {
+				Trace("Creating directory to save Config File '{}'", a_path.string());
+				std::filesystem::create_directories(a_path.parent_path());
+			}
+
+			auto temp = a_path;
+			temp += ".tmp";
+
+			{
+				std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+				if (!file.is_open()) {
+					Error("PersistenceService: Failed to open '{}' for writing.", temp.string());
+					return false;
+				}
+
+				file.write(a_contents.data(), static_cast<std::streamsize>(a_contents.size()));
+				file.flush();
+
+				if (!file) {
+					Error("PersistenceService: Failed to write '{}'.", temp.string());
+					return false;
+				}
+			}
+
+			// Replaces the existing file in one step; readers see either the old or new document.
+			std::filesystem::rename(temp, a_path);
+			return true;
+		} catch (const std::exception& e) {
+			Error("PersistenceService: Failed to save '{}': {}", a_path.string(), e.what());
+			return false;
+		}
+	}
+
+	// Runs on a worker (or the caller during Flush); the notification is handed to the UI thread.
+	bool PersistenceService::Write(const std::filesystem::path& a_path, const nlohmann::json& a_data)
+	{
+		if (WriteAtomic(a_path, a_data.dump(4))) {
+			Trace("Config file '{}' saved successfully", a_path.stem().string());
+			return true;
+		}
+
+		WorkerPool::GetSingleton()->PostToMain([name = a_path.filename().string()]() {
+			UINotification::ShowError(std::format("{} {}", Translate("ERROR_SAVE_FAILED"), name));
+		});
+
+		return false;
+	}
+
+	// Only the latest snapshot per file is kept. Each save pushes the write back by the window,
+	// but never past MAX_DELAY after the first save that made the document dirty.
+	void PersistenceService::Queue(const std::filesystem::path& a_path, const nlohmann::json& a_data)
+	{
+		Locker locker(m_lock);
+
+		const auto now = std::chrono::steady_clock::now();
+		auto& document = m_documents[a_path.string()];
+
+		if (!document.dirty) {
+			document.deadline = now + MAX_DELAY;
+		}
+
+		document.path = a_path;
+		document.data = a_data;
+		document.due = (std::min)(now + COALESCE_WINDOW, document.deadline);
+		document.dirty = true;
+
+		m_pending.store(true, std::memory_order_release);
+	}
+
+	// Called once per frame. Hands due documents to the worker pool, one write per file at a time.
+	void PersistenceService::Update()
+	{
+		if (!m_pending.load(std::memory_order_acquire))
+			return;
+
+		const auto now = std::chrono::steady_clock::now();
+		std::vector<std::tuple<std::string, std::filesystem::path, nlohmann::json>> due;
+
+		{
+			Locker locker(m_lock);
+			bool pending = false;
+
+			for (auto& [key, document] : m_documents) {
+				if (!document.dirty)
+					continue;
+
+				if (document.writing || document.due > now) {
+					pending = true;
+					continue;
+				}
+
+				document.dirty = false;
+				document.writing = true;
+				due.emplace_back(key, document.path, std::move(document.data));
+			}
+
+			m_pending.store(pending, std::memory_order_release);
+		}
+
+		// Submitted outside the lock; after pool shutdown the job runs inline and takes it itself.
+		for (auto& [key, path, data] : due) {
+			WorkerPool::GetSingleton()->Submit([this, key, path, data = std::move(data)]() {
+				const bool written = Write(path, data);
+
+				{
+					Locker locker(m_lock);
+					auto& document = m_documents[key];
+					document.writing = false;
+					document.failed = !written;
+
+					if (document.dirty) {
+						m_pending.store(true, std::memory_order_release);
+					}
+				}
+
+				m_idle.notify_all();
+			});
+		}
+	}
+
+	// Blocks until in-flight writes land, then writes anything still dirty on the calling thread.
+	// Used on shutdown, where the coalescing window no longer matters.
+	void PersistenceService::Flush()
+	{
+		std::vector<std::pair<std::filesystem::path, nlohmann::json>> remaining;
+
+		{
+			std::unique_lock<ExclusiveLock> locker(m_lock);
+			m_idle.wait(locker, [this]() {
+				return std::none_of(m_documents.begin(), m_documents.end(), [](const auto& a_entry) { return a_entry.second.writing; });
+			});
+
+			for (auto& [key, document] : m_documents) {
+				if (document.dirty) {
+					document.dirty = false;
+					remaining.emplace_back(document.path, std::move(document.data));
+				}
+			}
+
+			m_pending.store(false, std::memory_order_release);
+		}
+
+		for (const auto& [path, data] : remaining) {
+			const bool written = Write(path, data);
+
+			Locker locker(m_lock);
+			m_documents[path.string()].failed = !written;
+		}
+	}
+
+	PersistenceService::WriteStatus PersistenceService::GetStatus(const std::filesystem::path& a_path)
+	{
+		Locker locker(m_lock);
+
+		const auto it = m_documents.find(a_path.string());
+		if (it == m_documents.end()) {
+			return WriteStatus::None;
+		}
+
+		const auto& document = it->second;
+		if (document.failed) {
+			return WriteStatus::Failed;
+		}
+
+		return document.dirty || document.writing ? WriteStatus::Pending : WriteStatus::Written;
+	}
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <condition_variable>
+#include <filesystem>
+
+namespace Modex
+{
+	// Takes JSON document saves off the UI thread. Save() only snapshots the document; repeated
+	// saves to the same file inside COALESCE_WINDOW collapse into one write, which is serialized
+	// and written on the worker pool through a temp file + rename so a crash never leaves a
+	// half-written config behind. A steady stream of saves still writes within MAX_DELAY of the
+	// first one. Failed writes are logged, shown as an error notification, and reported by
+	// GetStatus until the file is written successfully.
+	class PersistenceService
+	{
+	public:
+		static inline PersistenceService* GetSingleton()
+		{
+			static PersistenceService singleton;
+			return std::addressof(singleton);
+		}
+
+		static constexpr std::chrono::milliseconds COALESCE_WINDOW{ 1000 };
+		static constexpr std::chrono::milliseconds MAX_DELAY{ 5000 };
+
+		enum class WriteStatus : uint8_t
+		{
+			None,     // never queued
+			Pending,  // queued or being written
+			Written,  // last write succeeded
+			Failed    // last write failed
+		};
+
+		void Queue(const std::filesystem::path& a_path, const nlohmann::json& a_data);
+		void Update();
+		void Flush();
+
+		WriteStatus GetStatus(const std::filesystem::path& a_path);
+
+		static bool WriteAtomic(const std::filesystem::path& a_path, const std::string& a_contents);
+
+	private:
+		struct Document
+		{
+			std::filesystem::path                 path;
+			nlohmann::json                        data;
+			std::chrono::steady_clock::time_point due;
+			std::chrono::steady_clock::time_point deadline; // first save since the last write + MAX_DELAY
+			bool                                  dirty = false;
+			bool                                  writing = false;
+			bool                                  failed = false;
+		};
+
+		static bool Write(const std::filesystem::path& a_path, const nlohmann::json& a_data);
+
+		ExclusiveLock                             m_lock;
+		std::condition_variable                   m_idle;
+		std::unordered_map<std::string, Document> m_documents;
+		std::atomic<bool>                         m_pending{ false };
+	};
+}
@@ -5,36 +5,33 @@
 
 namespace Modex
 {
-	ImVec4 ThemeConfig::GetColor(const std::string& a_key, float a_alphaMult)
+	// Resolves every slot from the loaded JSON into the idle palette, then publishes it. Missing
+	// or malformed keys are reported here once and fall back to the old red placeholder.
+	void ThemeConfig::CompilePalette()
 	{
-		auto& data = GetSingleton()->m_data;
+		const auto* current = m_palette.load(std::memory_order_acquire);
+		auto& palette = current == &m_palettes[0] ? m_palettes[1] : m_palettes[0];
+		const ImVec4 fallback(0.8f, 0.2f, 0.2f, 0.5f);
+
+		for (size_t i = 0; i < THEME_COLOR_COUNT; i++) {
+			const std::string key(THEME_COLOR_KEYS[i]);
+			ImVec4 color = fallback;
+
+			if (auto it = m_data.find(key); it != m_data.end()) {
+				try {
+					color = it->get<ImVec4>();
+				} catch (const std::exception& e) {
+					Warn("Theme '{}': color '{}' is malformed: {}", m_file_path.stem().string(), key, e.what());
+				}
+			} else {
+				Warn("Theme '{}': missing color '{}'", m_file_path.stem().string(), key);
+			}
 
-		auto it = data.find(a_key);
-		if (it != data.end()) {
-			ImVec4 color = it->get<ImVec4>();
-			color.w *= a_alphaMult;
-			return color;
+			palette.colors[i] = color;
+			palette.colorsU32[i] = ImGui::ColorConvertFloat4ToU32(color);
 		}
 
-		return ImVec4(0.8f, 0.2f, 0.2f, 0.5f); // Default to RED if key not found
-	}
-
-	ImVec4 ThemeConfig::GetHover(const std::string& a_key, float a_alphaMult)
-	{
-		ImVec4 color = GetColor(a_key, a_alphaMult);
-		return ImVec4(color.x + 0.05f, color.y + 0.05f, color.z + 0.10f, color.w);
-	}
-
-	ImVec4 ThemeConfig::GetActive(const std::string& a_key, float a_alphaMult)
-	{
-		ImVec4 color = GetColor(a_key, a_alphaMult);
-		return ImVec4(color.x + 0.10f, color.y + 0.10f, color.z + 0.15f, color.w);
-	}
-
-	ImU32 ThemeConfig::GetColorU32(const std::string& a_key, float a_alphaMult)
-	{
-		ImVec4 color = GetSingleton()->GetColor(a_key, a_alphaMult);
-		return ImGui::ColorConvertFloat4ToU32(color);
+		m_palette.store(&palette, std::memory_order_release);
 	}
 
 	std::optional<GraphicManager::Image> ThemeConfig::GetSplashLogo()
@@ -93,6 +90,7 @@ namespace Modex
 			theme_found = ConfigManager::Load(true);
 		}
 
+		CompilePalette();
 		ApplyThemeToImGui();
 		return theme_found;
 	}
@@ -102,47 +100,53 @@ namespace Modex
 		Debug("Loading/Switching Theme to '{}'", a_theme.m_name);
 
 		SetFilePath(a_theme.m_filePath);
-		return ConfigManager::Load(false);
+		if (!ConfigManager::Load(false)) {
+			return false;
+		}
+
+		CompilePalette();
+		ApplyThemeToImGui();
+		return true;
 	}
 
 	void ThemeConfig::ApplyThemeToImGui()
 	{
 		auto& style = ImGui::GetStyle();
-		style.Colors[ImGuiCol_FrameBg] = ThemeConfig::GetColor("BG");
-		style.Colors[ImGuiCol_FrameBgHovered] = ThemeConfig::GetHover("BG");
-		style.Colors[ImGuiCol_FrameBgActive] = ThemeConfig::GetActive("BG");
+		style.Colors[ImGuiCol_FrameBg] = ThemeConfig::GetColor(ThemeColor::Bg);
+		style.Colors[ImGuiCol_FrameBgHovered] = ThemeConfig::GetHover(ThemeColor::Bg);
+		style.Colors[ImGuiCol_FrameBgActive] = ThemeConfig::GetActive(ThemeColor::Bg);
 
-		style.Colors[ImGuiCol_Button] = ThemeConfig::GetColor("PRIMARY");
-		style.Colors[ImGuiCol_ButtonHovered] = ThemeConfig::GetHover("PRIMARY");
-		style.Colors[ImGuiCol_ButtonActive] = ThemeConfig::GetActive("PRIMARY");
+		style.Colors[ImGuiCol_Button] = ThemeConfig::GetColor(ThemeColor::Primary);
+		style.Colors[ImGuiCol_ButtonHovered] = ThemeConfig::GetHover(ThemeColor::Primary);
+		style.Colors[ImGuiCol_ButtonActive] = ThemeConfig::GetActive(ThemeColor::Primary);
 
-		style.Colors[ImGuiCol_Header] = ThemeConfig::GetColor("PRIMARY");
-		style.Colors[ImGuiCol_HeaderHovered] = ThemeConfig::GetHover("PRIMARY");
-		style.Colors[ImGuiCol_HeaderActive] = ThemeConfig::GetActive("PRIMARY");
+		style.Colors[ImGuiCol_Header] = ThemeConfig::GetColor(ThemeColor::Primary);
+		style.Colors[ImGuiCol_HeaderHovered] = ThemeConfig::GetHover(ThemeColor::Primary);
+		style.Colors[ImGuiCol_HeaderActive] = ThemeConfig::GetActive(ThemeColor::Primary);
 
-		style.Colors[ImGuiCol_SliderGrab] = ThemeConfig::GetColor("PRIMARY");
-		style.Colors[ImGuiCol_SliderGrabActive] = ThemeConfig::GetActive("PRIMARY");
+		style.Colors[ImGuiCol_SliderGrab] = ThemeConfig::GetColor(ThemeColor::Primary);
+		style.Colors[ImGuiCol_SliderGrabActive] = ThemeConfig::GetActive(ThemeColor::Primary);
 
-		style.Colors[ImGuiCol_ScrollbarBg] = ThemeConfig::GetColor("BG");
-		style.Colors[ImGuiCol_ScrollbarGrab] = ThemeConfig::GetColor("PRIMARY");
-		style.Colors[ImGuiCol_ScrollbarGrabHovered] = ThemeConfig::GetHover("PRIMARY");
-		style.Colors[ImGuiCol_ScrollbarGrabActive] = ThemeConfig::GetActive("PRIMARY");
+		style.Colors[ImGuiCol_ScrollbarBg] = ThemeConfig::GetColor(ThemeColor::Bg);
+		style.Colors[ImGuiCol_ScrollbarGrab] = ThemeConfig::GetColor(ThemeColor::Primary);
+		style.Colors[ImGuiCol_ScrollbarGrabHovered] = ThemeConfig::GetHover(ThemeColor::Primary);
+		style.Colors[ImGuiCol_ScrollbarGrabActive] = ThemeConfig::GetActive(ThemeColor::Primary);
 
-		style.Colors[ImGuiCol_Separator] = ThemeConfig::GetColor("PRIMARY");
-		style.Colors[ImGuiCol_SeparatorHovered] = ThemeConfig::GetHover("PRIMARY");
-		style.Colors[ImGuiCol_SeparatorActive] = ThemeConfig::GetActive("PRIMARY");
+		style.Colors[ImGuiCol_Separator] = ThemeConfig::GetColor(ThemeColor::Primary);
+		style.Colors[ImGuiCol_SeparatorHovered] = ThemeConfig::GetHover(ThemeColor::Primary);
+		style.Colors[ImGuiCol_SeparatorActive] = ThemeConfig::GetActive(ThemeColor::Primary);
 
-		style.Colors[ImGuiCol_ChildBg] = ThemeConfig::GetColor("NONE");
-		style.Colors[ImGuiCol_WindowBg] = ThemeConfig::GetColor("FRAME");
-		style.Colors[ImGuiCol_PopupBg] = ThemeConfig::GetColor("FRAME");
+		style.Colors[ImGuiCol_ChildBg] = ThemeConfig::GetColor(ThemeColor::None);
+		style.Colors[ImGuiCol_WindowBg] = ThemeConfig::GetColor(ThemeColor::Frame);
+		style.Colors[ImGuiCol_PopupBg] = ThemeConfig::GetColor(ThemeColor::Frame);
 
-		style.Colors[ImGuiCol_Text] = ThemeConfig::GetColor("TEXT");
-		style.Colors[ImGuiCol_TextDisabled] = ThemeConfig::GetColor("TEXT_DISABLED");
+		style.Colors[ImGuiCol_Text] = ThemeConfig::GetColor(ThemeColor::Text);
+		style.Colors[ImGuiCol_TextDisabled] = ThemeConfig::GetColor(ThemeColor::TextDisabled);
 
-		style.Colors[ImGuiCol_TableRowBg] = ThemeConfig::GetColor("TABLE_BG");
-		style.Colors[ImGuiCol_TableRowBgAlt] = ThemeConfig::GetHover("TABLE_BG_ALT");
+		style.Colors[ImGuiCol_TableRowBg] = ThemeConfig::GetColor(ThemeColor::TableBg);
+		style.Colors[ImGuiCol_TableRowBgAlt] = ThemeConfig::GetHover(ThemeColor::TableBgAlt);
 
-		style.Colors[ImGuiCol_Border] = ThemeConfig::GetColor("BORDER");
+		style.Colors[ImGuiCol_Border] = ThemeConfig::GetColor(ThemeColor::Border);
 	}
 
 	ThemeConfig::ThemeConfig()
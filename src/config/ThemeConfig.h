@@ -8,6 +8,87 @@ namespace Modex
 	static const std::filesystem::path THEMES_JSON_PATH = 
 	std::filesystem::path("data") / "interface" / "modex" / "user" / "themes" / "default.json";
 
+	// Every color slot a theme provides, with the JSON key it is read from. Themes are compiled
+	// into a flat palette indexed by ThemeColor, so per-frame lookups never touch the JSON.
+	#define MODEX_THEME_COLORS(X)                          \
+		X(None, "NONE")                                    \
+		X(Error, "ERROR")                                  \
+		X(Warn, "WARN")                                    \
+		X(Success, "SUCCESS")                              \
+		X(Confirm, "CONFIRM")                              \
+		X(Decline, "DECLINE")                              \
+		X(Frame, "FRAME")                                  \
+		X(Border, "BORDER")                                \
+		X(TableBg, "TABLE_BG")                             \
+		X(TableBgAlt, "TABLE_BG_ALT")                      \
+		X(TableBorder, "TABLE_BORDER")                     \
+		X(TableSelected, "TABLE_SELECTED")                 \
+		X(TableHover, "TABLE_HOVER")                       \
+		X(Bg, "BG")                                        \
+		X(BgLight, "BG_LIGHT")                             \
+		X(Primary, "PRIMARY")                              \
+		X(Secondary, "SECONDARY")                          \
+		X(Text, "TEXT")                                    \
+		X(TextHeader, "TEXT_HEADER")                       \
+		X(TextDisabled, "TEXT_DISABLED")                   \
+		X(TextEnchanted, "TEXT_ENCHANTED")                 \
+		X(TextUnique, "TEXT_UNIQUE")                       \
+		X(TextEssential, "TEXT_ESSENTIAL")                 \
+		X(TextUniqueEssential, "TEXT_UNIQUE_ESSENTIAL")    \
+		X(ScreenBackground, "SCREEN_BACKGROUND")           \
+		X(WindowBackground, "WINDOW_BACKGROUND")           \
+		X(Filter0, "FILTER_0")                             \
+		X(Filter1, "FILTER_1")                             \
+		X(Filter2, "FILTER_2")                             \
+		X(Filter3, "FILTER_3")                             \
+		X(Filter4, "FILTER_4")                             \
+		X(Filter5, "FILTER_5")                             \
+		X(Filter6, "FILTER_6")                             \
+		X(Filter7, "FILTER_7")                             \
+		X(Filter8, "FILTER_8")                             \
+		X(Filter9, "FILTER_9")                             \
+		X(TypeArmor, "ARMO")                               \
+		X(TypeAlchemy, "ALCH")                             \
+		X(TypeAmmo, "AMMO")                                \
+		X(TypeBook, "BOOK")                                \
+		X(TypeIngredient, "INGR")                          \
+		X(TypeKey, "KEYM")                                 \
+		X(TypeMisc, "MISC")                                \
+		X(TypeScroll, "SCRL")                              \
+		X(TypeWeapon, "WEAP")                              \
+		X(TypeNPC, "NPC_")                                 \
+		X(TypeTree, "TREE")                                \
+		X(TypeStatic, "STAT")                              \
+		X(TypeContainer, "CONT")                           \
+		X(TypeActivator, "ACTI")                           \
+		X(TypeLight, "LIGH")                               \
+		X(TypeDoor, "DOOR")                                \
+		X(TypeFurniture, "FURN")                           \
+		X(TypeOutfit, "OTFT")                              \
+		X(TypeLeveledItem, "LVLI")
+
+	enum class ThemeColor : uint32_t
+	{
+	#define MODEX_THEME_COLOR_ENUM(a_name, a_key) a_name,
+		MODEX_THEME_COLORS(MODEX_THEME_COLOR_ENUM)
+	#undef MODEX_THEME_COLOR_ENUM
+		kTotal
+	};
+
+	inline constexpr size_t THEME_COLOR_COUNT = static_cast<size_t>(ThemeColor::kTotal);
+
+	inline constexpr std::array<std::string_view, THEME_COLOR_COUNT> THEME_COLOR_KEYS = {
+	#define MODEX_THEME_COLOR_KEY(a_name, a_key) a_key,
+		MODEX_THEME_COLORS(MODEX_THEME_COLOR_KEY)
+	#undef MODEX_THEME_COLOR_KEY
+	};
+
+	struct ThemePalette
+	{
+		std::array<ImVec4, THEME_COLOR_COUNT> colors{};
+		std::array<ImU32, THEME_COLOR_COUNT>  colorsU32{};
+	};
+
 	struct ModexTheme
 	{
 		std::string m_name;
@@ -25,6 +106,14 @@ namespace Modex
 	private:
 		std::vector<ModexTheme> m_availableThemes;
 
+		// Double-buffered so a reload compiles into the idle palette and publishes it in one store.
+		std::array<ThemePalette, 2>        m_palettes{};
+		std::atomic<const ThemePalette*>   m_palette{ &m_palettes[0] };
+
+		void CompilePalette();
+
+		static const ThemePalette& Palette() { return *GetSingleton()->m_palette.load(std::memory_order_acquire); }
+
 	public:
 		static inline ThemeConfig* GetSingleton()
 		{
@@ -40,12 +129,38 @@ namespace Modex
 
 		static std::optional<GraphicManager::Image> GetSplashLogo();
 
-		// Could generate and cache a struct to handle this behavior...
-		static ImVec4 GetColor(const std::string& a_key, float a_alphaMult = 1.0f);
-		static ImVec4 GetHover(const std::string& a_key, float a_alphaMult = 1.0f);
-		static ImVec4 GetActive(const std::string& a_key, float a_alphaMult = 1.0f);
+		static ImVec4 GetColor(ThemeColor a_slot, float a_alphaMult = 1.0f)
+		{
+			ImVec4 color = Palette().colors[static_cast<size_t>(a_slot)];
+			color.w *= a_alphaMult;
+			return color;
+		}
+
+		static ImVec4 GetHover(ThemeColor a_slot, float a_alphaMult = 1.0f)
+		{
+			ImVec4 color = GetColor(a_slot, a_alphaMult);
+			return ImVec4(color.x + 0.05f, color.y + 0.05f, color.z + 0.10f, color.w);
+		}
+
+		static ImVec4 GetActive(ThemeColor a_slot, float a_alphaMult = 1.0f)
+		{
+			ImVec4 color = GetColor(a_slot, a_alphaMult);
+			return ImVec4(color.x + 0.10f, color.y + 0.10f, color.z + 0.15f, color.w);
+		}
 
-		static ImU32 GetColorU32(const std::string& a_key, float a_alphaMult = 1.0f);
+		static ImU32 GetColorU32(ThemeColor a_slot, float a_alphaMult = 1.0f)
+		{
+			if (a_alphaMult == 1.0f) {
+				return Palette().colorsU32[static_cast<size_t>(a_slot)];
+			}
+
+			return ImGui::ColorConvertFloat4ToU32(GetColor(a_slot, a_alphaMult));
+		}
+
+		static ThemeColor GetFilterColor(uint32_t a_index)
+		{
+			return static_cast<ThemeColor>(static_cast<uint32_t>(ThemeColor::Filter0) + (a_index % 10));
+		}
 
 		static const std::vector<ModexTheme>& GetAvailableThemes() { return GetSingleton()->m_availableThemes; }
 	};
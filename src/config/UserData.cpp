@@ -4,12 +4,61 @@
 
 namespace Modex
 {
-	void UserData::Save()
+	std::string SerializedList::Key(const SerializedObject& a_item)
+	{
+		if (a_item.refid != 0) {
+			return std::format("{}|{:08X}", static_cast<uint32_t>(a_item.owner), a_item.refid);
+		}
+
+		return std::format("{}|{}|{}", static_cast<uint32_t>(a_item.owner), a_item.plugin, a_item.editorid);
+	}
+
+	// Returns true if the item was not already present. Existing entries only move to the front.
+	bool SerializedList::PushFront(const SerializedObject& a_item)
+	{
+		auto key = Key(a_item);
+
+		if (auto it = index.find(key); it != index.end()) {
+			items.splice(items.begin(), items, it->second);
+			return false;
+		}
+
+		items.push_front(a_item);
+		index.emplace(std::move(key), items.begin());
+		return true;
+	}
+
+	bool SerializedList::Erase(Iterator a_it)
+	{
+		if (a_it == items.end())
+			return false;
+
+		index.erase(Key(*a_it));
+		items.erase(a_it);
+		return true;
+	}
+
+	void SerializedList::Assign(const std::vector<SerializedObject>& a_items)
 	{
-		auto data = m_userDataConfig.GetData();
+		Clear();
+
+		// Stored newest first, so insert from the back to keep the persisted order.
+		for (auto it = a_items.rbegin(); it != a_items.rend(); ++it) {
+			PushFront(*it);
+		}
+	}
+
+	void SerializedList::Clear()
+	{
+		items.clear();
+		index.clear();
+	}
 
-		m_userDataConfig.Set<std::vector<SerializedObject>>("Recently Used List", m_recent.items);
-		m_userDataConfig.Set<std::vector<SerializedObject>>("Favorite List", m_favorites.items);
+	void UserData::Save()
+	{
+		m_userDataConfig.Set<std::vector<SerializedObject>>("Recently Used List", m_recent.list.ToVector());
+		m_userDataConfig.Set<std::vector<SerializedObject>>("Favorite List", m_favorites.list.ToVector());
+		m_userDataConfig.Set<size_t>("Recently Used Capacity", m_recent.maxSize);
 
 		m_userDataConfig.Save();
 	}
@@ -19,70 +68,135 @@ namespace Modex
 		m_userDataConfig.SetFilePath(USERDATA_JSON_PATH);
 		m_userDataConfig.Load(true);
 
-		m_recent.items = m_userDataConfig.Get<std::vector<SerializedObject>>("Recently Used List", {});
-		m_favorites.items = m_userDataConfig.Get<std::vector<SerializedObject>>("Favorite List", {});
+		m_recent.maxSize = (std::max)(m_userDataConfig.Get<size_t>("Recently Used Capacity", DEFAULT_RECENT_CAPACITY), size_t(1));
+		m_recent.list.Assign(m_userDataConfig.Get<std::vector<SerializedObject>>("Recently Used List", {}));
+		SetRecentCapacity(m_recent.maxSize);
+
+		m_favorites.list.Clear();
+		m_favorites.editorids.clear();
+		m_favorites.refids.clear();
+
+		const auto favorites = m_userDataConfig.Get<std::vector<SerializedObject>>("Favorite List", {});
+		for (auto it = favorites.rbegin(); it != favorites.rend(); ++it) {
+			AddToFavorites(*it);
+		}
 	}
 
 	bool UserData::IsFavorited(const std::string& a_editorid)
 	{
-		auto& favorites = UserData::GetFavorites();
-		return std::find_if(favorites.items.begin(), favorites.items.end(), [&a_editorid](const auto& item) 
-		{ return item.editorid == a_editorid; }) != favorites.items.end();
+		return m_favorites.editorids.contains(a_editorid);
 	}
 
 	bool UserData::IsFavorited(RE::FormID a_refid)
 	{
-		auto& favorites = UserData::GetFavorites();
-		return std::find_if(favorites.items.begin(), favorites.items.end(), [&a_refid](const auto& item) 
-		{ return item.refid == a_refid; }) != favorites.items.end();
+		return m_favorites.refids.contains(a_refid);
 	}
 
-	void AddToRecentList(const std::unique_ptr<BaseObject>& a_item)
+	void UserData::SetRecentCapacity(size_t a_capacity)
 	{
-		auto& recent = UserData::GetRecent();
+		m_recent.maxSize = (std::max)(a_capacity, size_t(1));
 
-		SerializedObject newItem{ a_item->GetPluginName(), a_item->GetEditorID(), a_item->GetRefID(), a_item->GetOwnership() };
-		recent.items.erase(std::remove(recent.items.begin(), recent.items.end(), newItem), recent.items.end());
-		recent.items.insert(recent.items.begin(), newItem);
+		while (m_recent.list.items.size() > m_recent.maxSize) {
+			m_recent.list.Erase(std::prev(m_recent.list.items.end()));
+		}
+	}
 
-		if (recent.items.size() > recent.maxSize) {
-			recent.items.pop_back();
+	void UserData::AddToRecent(const SerializedObject& a_item)
+	{
+		m_recent.list.PushFront(a_item);
+
+		if (m_recent.list.items.size() > m_recent.maxSize) {
+			m_recent.list.Erase(std::prev(m_recent.list.items.end()));
 		}
 	}
 
-	void RemoveFromRecentList(const std::unique_ptr<BaseObject>& a_item)
+	// References match by refid, everything else by EditorID regardless of plugin or owner.
+	void UserData::RemoveFromRecent(const std::string& a_editorid, RE::FormID a_refid)
 	{
-		auto& recent = UserData::GetRecent();
-		recent.items.erase(std::remove_if(recent.items.begin(), recent.items.end(), [&a_item](const auto& item) 
-		{ 
-			if (a_item->GetRefID() != 0) {
-				return item.refid == a_item->GetRefID();
-			} else {
-				return item.editorid == a_item->GetEditorID();
+		auto& items = m_recent.list.items;
+		for (auto it = items.begin(); it != items.end();) {
+			const bool match = a_refid != 0 ? it->refid == a_refid : it->editorid == a_editorid;
+			auto next = std::next(it);
+
+			if (match) {
+				m_recent.list.Erase(it);
 			}
-		}), recent.items.end());
+
+			it = next;
+		}
 	}
 
-	void AddToFavorites(const std::unique_ptr<BaseObject>& a_item)
+	void UserData::AddToFavorites(const SerializedObject& a_item)
 	{
-		auto& favorites = UserData::GetFavorites();
+		if (m_favorites.list.PushFront(a_item)) {
+			m_favorites.editorids[a_item.editorid]++;
 
-		SerializedObject newItem{ a_item->GetPluginName(), a_item->GetEditorID(), a_item->GetRefID(), a_item->GetOwnership() };
-		favorites.items.erase(std::remove(favorites.items.begin(), favorites.items.end(), newItem), favorites.items.end());
-		favorites.items.insert(favorites.items.begin(), newItem);
+			if (a_item.refid != 0) {
+				m_favorites.refids[a_item.refid]++;
+			}
+		}
 	}
 
-	void RemoveFromFavorites(const std::unique_ptr<BaseObject>& a_item)
+	// Same matching rules as RemoveFromRecent. A reference is normally stored under the key it
+	// was favorited with, so that case is a single index lookup; the scan is the fallback.
+	void UserData::RemoveFromFavorites(const SerializedObject& a_item)
 	{
-		auto& favorites = UserData::GetFavorites();
-		favorites.items.erase(std::remove_if(favorites.items.begin(), favorites.items.end(), [&a_item](const auto& item) 
-		{ 
-			if (a_item->GetRefID() != 0) {
-				return item.refid == a_item->GetRefID();
-			} else {
-				return item.editorid == a_item->GetEditorID();
+		auto release = [](auto& a_counts, const auto& a_key) {
+			if (auto it = a_counts.find(a_key); it != a_counts.end() && --it->second == 0) {
+				a_counts.erase(it);
 			}
-		}), favorites.items.end());
+		};
+
+		auto erase = [&](SerializedList::Iterator a_it) {
+			release(m_favorites.editorids, a_it->editorid);
+
+			if (a_it->refid != 0) {
+				release(m_favorites.refids, a_it->refid);
+			}
+
+			m_favorites.list.Erase(a_it);
+		};
+
+		if (a_item.refid != 0) {
+			if (!m_favorites.refids.contains(a_item.refid))
+				return;
+
+			if (auto it = m_favorites.list.index.find(SerializedList::Key(a_item)); it != m_favorites.list.index.end()) {
+				erase(it->second);
+
+				if (!m_favorites.refids.contains(a_item.refid))
+					return;
+			}
+		} else if (!m_favorites.editorids.contains(a_item.editorid)) {
+			return;
+		}
+
+		auto& items = m_favorites.list.items;
+		for (auto it = items.begin(); it != items.end();) {
+			const bool match = a_item.refid != 0 ? it->refid == a_item.refid : it->editorid == a_item.editorid;
+			auto next = std::next(it);
+
+			if (match) {
+				erase(it);
+			}
+
+			it = next;
+		}
+	}
+
+	static SerializedObject Serialize(const std::unique_ptr<BaseObject>& a_item)
+	{
+		return { a_item->GetPluginName(), a_item->GetEditorID(), a_item->GetRefID(), a_item->GetOwnership() };
+	}
+
+	void AddToRecentList(const std::unique_ptr<BaseObject>& a_item)
+	{
+		UserData::AddToRecent(Serialize(a_item));
+	}
+
+	void RemoveFromRecentList(const std::unique_ptr<BaseObject>& a_item)
+	{
+		UserData::RemoveFromRecent(a_item->GetEditorID(), a_item->GetRefID());
 	}
 
 	void DispatchEDIDToFavorites(ModexActionType a_actionType, const std::string& a_editorid, Ownership a_owner)
@@ -136,6 +250,57 @@ namespace Modex
 		}
 	}
 
+	// Batch commands report once per batch. Only the tail of the batch can survive in the recent
+	// list, so earlier entries are skipped, and a single notification summarizes the rest.
+	// a_quantity is the total amount moved across all forms; a_target names the recipient.
+	void UserData::SendBatchEvent(ModexActionType a_actionType, const std::vector<RE::TESForm*>& a_forms, uint32_t a_quantity, RE::TESObjectREFR* a_target, Ownership a_owner)
+	{
+		if (a_forms.empty())
+			return;
+
+		if (a_forms.size() == 1 && a_quantity <= 1) {
+			UserData::SendEvent(a_actionType, std::make_unique<BaseObject>(a_forms.front(), a_owner));
+			return;
+		}
+
+		const size_t capacity = UserData::GetRecentCapacity();
+		const size_t first = a_forms.size() > capacity ? a_forms.size() - capacity : 0;
+
+		for (size_t i = first; i < a_forms.size(); i++) {
+			if (a_forms[i]) {
+				AddToRecentList(std::make_unique<BaseObject>(a_forms[i], a_owner));
+			}
+		}
+
+		// The row names the recipient, so follow-up batches to the same target keep merging into
+		// "(N items, M types)" while a different target starts a new row.
+		const char* name = a_target ? a_target->GetDisplayFullName() : nullptr;
+		const std::string target = name && *name ? name : BaseObject(a_forms.back(), a_owner).GetName();
+
+		std::vector<RE::FormID> forms;
+		forms.reserve(a_forms.size());
+		for (const auto* form : a_forms) {
+			if (form) forms.push_back(form->GetFormID());
+		}
+
+		switch (a_actionType) {
+			case ModexActionType::AddItem:
+				UINotification::ShowAction(Translate("ADD_SELECTION"), target, ICON_LC_PLUS, UIMessageType::Info, 3.0f, a_quantity, forms);
+				break;
+			case ModexActionType::RemoveItem:
+				UINotification::ShowAction(Translate("REMOVE_SELECTION"), target, ICON_LC_MINUS, UIMessageType::Warning, 3.0f, a_quantity, forms);
+				break;
+			case ModexActionType::EquipItem:
+				UINotification::ShowAction(Translate("EQUIP_SELECTION"), target, ICON_LC_SHIRT, UIMessageType::Info, 3.0f, a_quantity, forms);
+				break;
+			case ModexActionType::PlaceAtMe:
+				UINotification::ShowAction(Translate("PLACE_SELECTION"), target, ICON_LC_MOUNTAIN, UIMessageType::Info, 3.0f, a_quantity, forms);
+				break;
+			default: Error("Missed switch case for SendBatchEvent(ModexActionType a_actionType, ...)");
+				break;
+		}
+	}
+
 	// Primary end-of-line SendEvent function to dispatch notifications based on Objects.
 	void UserData::SendEvent(ModexActionType a_actionType, const std::unique_ptr<BaseObject>& a_item)
 	{
@@ -187,7 +352,8 @@ namespace Modex
 				UINotification::ShowAction(Translate("DISABLE_REFERENCE"), a_item->GetName(), ICON_LC_CHECK);
 				break;
 			case ModexActionType::Favorited:
-				AddToFavorites(a_item);
+				// Not saved here: favorites are toggled per selection, and the caller saves once.
+				UserData::AddToFavorites(Serialize(a_item));
 				UINotification::ShowAction(Translate("ADD_TO_FAVORITES"), a_item->GetName(), ICON_LC_HEART);
 				break;
 			case Modex::ModexActionType::SetDefaultOutfit:
@@ -199,7 +365,7 @@ namespace Modex
 				UINotification::ShowAction(Translate("SET_SLEEP_OUTFIT"), a_item->GetEditorID(), ICON_LC_SHIRT);
 				break;
 			case ModexActionType::Unfavorited:
-				RemoveFromFavorites(a_item);
+				UserData::RemoveFromFavorites(Serialize(a_item));
 				UINotification::ShowAction(Translate("REMOVE_FROM_FAVORITES"), a_item->GetName(), ICON_LC_HEART_OFF);
 				break;
 			case ModexActionType::EquipOutfit:
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <list>
+
 #include "ConfigManager.h"
 #include "data/BaseObject.h"
 
@@ -40,20 +42,45 @@ namespace Modex
 		Total,
 	};
 
+	// Newest-first list of serialized objects with an index on the identity SerializedObject's
+	// operator== uses, so lookups, move-to-front and removal don't scan the list.
+	struct SerializedList {
+		using Iterator = std::list<SerializedObject>::iterator;
+
+		std::list<SerializedObject>             items;
+		std::unordered_map<std::string, Iterator> index;
+
+		static std::string Key(const SerializedObject& a_item);
+
+		bool Contains(const SerializedObject& a_item) const { return index.contains(Key(a_item)); }
+		bool PushFront(const SerializedObject& a_item);
+		bool Erase(Iterator a_it);
+		void Assign(const std::vector<SerializedObject>& a_items);
+		void Clear();
+		std::vector<SerializedObject> ToVector() const { return { items.begin(), items.end() }; }
+	};
+
 	class UserData
 	{
 	private:
+		// LRU: touching an entry moves it to the front, the back is evicted past maxSize.
 		struct RecentData {
-			std::vector<SerializedObject> items;
+			SerializedList list;
 			size_t maxSize;
 		};
 
+		// IsFavorited runs for every visible row each frame, so it checks these counts instead
+		// of the list. Counts, since several favorites can share an EditorID (references).
 		struct FavoriteData {
-			std::vector<SerializedObject> items;
+			SerializedList list;
+			std::unordered_map<std::string, uint32_t> editorids;
+			std::unordered_map<RE::FormID, uint32_t>  refids;
 		};
 
-		static inline RecentData m_recent{ {}, 50 };
-		static inline FavoriteData m_favorites{ {} };
+		static inline constexpr size_t DEFAULT_RECENT_CAPACITY = 50;
+
+		static inline RecentData m_recent{ {}, DEFAULT_RECENT_CAPACITY };
+		static inline FavoriteData m_favorites{};
 
 		static inline ConfigManager m_userDataConfig;
 
@@ -70,16 +97,21 @@ namespace Modex
 		static void SendEvent(ModexActionType a_actionType, const std::unique_ptr<BaseObject>& a_item);
 		static void SendEvent(ModexActionType a_actionType, const std::string& a_text, Ownership a_owner);
 		static void SendEvent(ModexActionType a_actionType, RE::FormID a_refid, Ownership a_owner);
+		static void SendBatchEvent(ModexActionType a_actionType, const std::vector<RE::TESForm*>& a_forms, uint32_t a_quantity, RE::TESObjectREFR* a_target, Ownership a_owner);
 
 		// recent
-		static std::vector<SerializedObject> GetRecentAsVector() { return m_recent.items; }
-		static RecentData& GetRecent() { return m_recent; }
+		static const std::list<SerializedObject>& GetRecentItems() { return m_recent.list.items; }
+		static size_t GetRecentCapacity() { return m_recent.maxSize; }
+		static void SetRecentCapacity(size_t a_capacity);
+		static void AddToRecent(const SerializedObject& a_item);
+		static void RemoveFromRecent(const std::string& a_editorid, RE::FormID a_refid);
 
 		// favorites
-		static std::vector<SerializedObject> GetFavoritesAsVector() { return m_favorites.items; }
-		static FavoriteData& GetFavorites() { return m_favorites; }
+		static const std::list<SerializedObject>& GetFavoriteItems() { return m_favorites.list.items; }
 		static bool IsFavorited(const std::string& a_editorid);
 		static bool IsFavorited(RE::FormID a_refid);
+		static void AddToFavorites(const SerializedObject& a_item);
+		static void RemoveFromFavorites(const SerializedObject& a_item);
 
 		static nlohmann::json& GetData() { return m_userDataConfig.GetData(); }
 
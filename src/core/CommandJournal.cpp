@@ -0,0 +1,244 @@
+#include "CommandJournal.h"
+#include "core/Commands.h"
+#include "ui/components/UINotification.h"
+
+namespace Modex
+{
+	namespace
+	{
+		std::vector<Commands::BatchItem> ResolveDeltas(const std::vector<CommandJournal::Delta>& a_deltas)
+		{
+			std::vector<Commands::BatchItem> items;
+			items.reserve(a_deltas.size());
+
+			for (const auto& delta : a_deltas) {
+				if (auto object = RE::TESForm::LookupByID<RE::TESBoundObject>(delta.form)) {
+					items.push_back({ object, delta.count, delta.equip });
+				}
+			}
+
+			return items;
+		}
+
+		const char* GetActionLabel(ModexActionType a_action)
+		{
+			switch (a_action) {
+			case ModexActionType::RemoveItem:       return "REMOVE_SELECTION";
+			case ModexActionType::EquipItem:        return "EQUIP_SELECTION";
+			case ModexActionType::PlaceAtMe:        return "PLACE_SELECTION";
+			case ModexActionType::EquipOutfit:      return "EQUIP_OUTFIT_ITEMS";
+			case ModexActionType::AddOutfit:        return "ADD_OUTFIT_ITEMS";
+			case ModexActionType::SetDefaultOutfit: return "SET_DEFAULT_OUTFIT";
+			case ModexActionType::SetSleepOutfit:   return "SET_SLEEP_OUTFIT";
+			default:                                return "ADD_SELECTION";
+			}
+		}
+
+		Commands::BatchAction GetForwardAction(ModexActionType a_action)
+		{
+			switch (a_action) {
+			case ModexActionType::RemoveItem:  return Commands::BatchAction::Remove;
+			case ModexActionType::EquipItem:   return Commands::BatchAction::Equip;
+			case ModexActionType::EquipOutfit: return Commands::BatchAction::Equip;
+			case ModexActionType::PlaceAtMe:   return Commands::BatchAction::Place;
+			default:                           return Commands::BatchAction::Add;
+			}
+		}
+	}
+
+	void CommandJournal::Record(Entry&& a_entry)
+	{
+		if (a_entry.Cost() > MAX_COST) {
+			Warn("CommandJournal: Action with {} changes exceeds the journal limit and cannot be undone.", a_entry.Cost());
+			return;
+		}
+
+		Locker locker(m_lock);
+
+		// A new action invalidates anything that was undone before it.
+		for (const auto& entry : m_redo) {
+			m_cost -= entry.Cost();
+		}
+		m_redo.clear();
+
+		m_cost += a_entry.Cost();
+		m_undo.push_back(std::move(a_entry));
+		Trim();
+	}
+
+	// Assumes m_lock is held. Drops the oldest undo entries first, then the oldest redo entries.
+	void CommandJournal::Trim()
+	{
+		while (!m_undo.empty() && (m_undo.size() + m_redo.size() > MAX_ENTRIES || m_cost > MAX_COST)) {
+			m_cost -= m_undo.front().Cost();
+			m_undo.pop_front();
+		}
+
+		while (!m_redo.empty() && (m_redo.size() > MAX_ENTRIES || m_cost > MAX_COST)) {
+			m_cost -= m_redo.front().Cost();
+			m_redo.pop_front();
+		}
+	}
+
+	void CommandJournal::Finish(Entry&& a_entry, bool a_undone)
+	{
+		const std::string label = a_entry.IsOutfitSwap() ?
+			std::string(Translate(GetActionLabel(a_entry.action))) :
+			std::format("{} ({})", Translate(GetActionLabel(a_entry.action)), a_entry.deltas.size());
+
+		{
+			Locker locker(m_lock);
+			m_cost += a_entry.Cost();
+			(a_undone ? m_redo : m_undo).push_back(std::move(a_entry));
+			Trim();
+		}
+
+		m_busy.store(false, std::memory_order_release);
+
+		if (a_undone) {
+			UINotification::ShowAction(Translate("UNDO"), label, ICON_LC_UNDO_2);
+		} else {
+			UINotification::ShowAction(Translate("REDO"), label, ICON_LC_REDO_2);
+		}
+	}
+
+	// Assumes m_busy is held. Moves the newest entry off a_stack once its target resolves;
+	// placements don't need one. An entry whose target is unloaded stays put so it can be retried.
+	bool CommandJournal::Take(std::deque<Entry>& a_stack, Entry& a_entry, RE::NiPointer<RE::TESObjectREFR>& a_target)
+	{
+		{
+			Locker locker(m_lock);
+			if (a_stack.empty()) {
+				return false;
+			}
+
+			auto& newest = a_stack.back();
+			if (newest.action != ModexActionType::PlaceAtMe) {
+				a_target = newest.target.get();
+			}
+
+			if (a_target || newest.action == ModexActionType::PlaceAtMe) {
+				a_entry = std::move(newest);
+				a_stack.pop_back();
+				m_cost -= a_entry.Cost();
+				return true;
+			}
+		}
+
+		Warn("CommandJournal: Target reference is no longer available.");
+		UINotification::ShowError(Translate("UNDO_TARGET_MISSING"));
+		return false;
+	}
+
+	// Runs on the game thread. Puts the entry's outfit back on the target's base form and keeps
+	// the one it replaced, which is what the opposite stack needs to reverse this.
+	void CommandJournal::SwapOutfit(std::shared_ptr<Entry> a_entry, RE::NiPointer<RE::TESObjectREFR> a_target, bool a_undone)
+	{
+		SKSE::GetTaskInterface()->AddTask([this, a_entry, a_target, a_undone]() {
+			auto actor = a_target->As<RE::Actor>();
+			auto base = actor ? actor->GetActorBase() : nullptr;
+
+			if (base) {
+				auto& slot = a_entry->action == ModexActionType::SetSleepOutfit ? base->sleepOutfit : base->defaultOutfit;
+				auto* previous = slot;
+
+				slot = a_entry->outfit ? RE::TESForm::LookupByID<RE::BGSOutfit>(a_entry->outfit) : nullptr;
+				a_entry->outfit = previous ? previous->GetFormID() : 0;
+			}
+
+			Finish(std::move(*a_entry), a_undone);
+		});
+	}
+
+	// Replays the inverse of the newest entry. Removals are restored as fresh base objects, so
+	// per-instance extra data (tempering, player enchantments) is not brought back.
+	bool CommandJournal::Undo()
+	{
+		bool expected = false;
+		if (!m_busy.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+			return false;
+
+		auto entry = std::make_shared<Entry>();
+		RE::NiPointer<RE::TESObjectREFR> target;
+
+		if (!Take(m_undo, *entry, target)) {
+			m_busy.store(false, std::memory_order_release);
+			return false;
+		}
+
+		if (entry->IsOutfitSwap()) {
+			SwapOutfit(entry, target, true);
+			return true;
+		}
+
+		if (entry->action == ModexActionType::PlaceAtMe) {
+			auto refs = std::move(entry->spawned);
+			entry->spawned.clear();
+
+			Commands::DeleteReferences(std::move(refs), [this, entry]() {
+				Finish(std::move(*entry), true);
+			});
+
+			return true;
+		}
+
+		const auto inverse = entry->action == ModexActionType::RemoveItem ? Commands::BatchAction::Add : Commands::BatchAction::Remove;
+
+		// Removals are clamped to what the target still holds, so keep only what was actually
+		// reversed; redo then replays that instead of the original amounts.
+		Commands::RunBatch(entry->owner, target.get(), inverse, ResolveDeltas(entry->deltas), [this, entry](Commands::BatchState& a_state) {
+			entry->deltas = std::move(a_state.deltas);
+			Finish(std::move(*entry), true);
+		});
+
+		return true;
+	}
+
+	bool CommandJournal::Redo()
+	{
+		bool expected = false;
+		if (!m_busy.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+			return false;
+
+		auto entry = std::make_shared<Entry>();
+		RE::NiPointer<RE::TESObjectREFR> target;
+
+		if (!Take(m_redo, *entry, target)) {
+			m_busy.store(false, std::memory_order_release);
+			return false;
+		}
+
+		if (entry->IsOutfitSwap()) {
+			SwapOutfit(entry, target, false);
+			return true;
+		}
+
+		Commands::RunBatch(entry->owner, target.get(), GetForwardAction(entry->action), ResolveDeltas(entry->deltas), [this, entry](Commands::BatchState& a_state) {
+			entry->deltas = std::move(a_state.deltas);
+			entry->spawned = std::move(a_state.spawned);
+			Finish(std::move(*entry), false);
+		});
+
+		return true;
+	}
+
+	void CommandJournal::Clear()
+	{
+		Locker locker(m_lock);
+		m_undo.clear();
+		m_redo.clear();
+		m_cost = 0;
+	}
+
+	bool CommandJournal::CanUndo() const
+	{
+		Locker locker(m_lock);
+		return !m_undo.empty();
+	}
+
+	bool CommandJournal::CanRedo() const
+	{
+		Locker locker(m_lock);
+		return !m_redo.empty();
+	}
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>
+#include <deque>
+
+#include "config/UserData.h"
+
+namespace Modex
+{
+	// Records what each inventory, placement or outfit command actually changed so it can be
+	// reversed. Entries only hold FormIDs, counts and reference handles; nothing here touches the
+	// game until Undo/Redo hands an inverse batch back to Commands.
+	class CommandJournal
+	{
+	public:
+		static inline CommandJournal* GetSingleton()
+		{
+			static CommandJournal singleton;
+			return std::addressof(singleton);
+		}
+
+		// equip marks kit items that were worn when added, so redo wears them again.
+		struct Delta {
+			RE::FormID form;
+			uint32_t   count;
+			bool       equip = false;
+		};
+
+		// Default and sleep outfit swaps keep the outfit to swap back in. Applying one yields the
+		// outfit it replaced, so the same entry serves both undo and redo.
+		struct Entry {
+			ModexActionType                  action;
+			Ownership                        owner;
+			RE::ObjectRefHandle              target;
+			std::vector<Delta>               deltas;
+			std::vector<RE::ObjectRefHandle> spawned;
+			RE::FormID                       outfit = 0;
+
+			size_t Cost() const { return deltas.size() + spawned.size(); }
+			bool   IsOutfitSwap() const { return action == ModexActionType::SetDefaultOutfit || action == ModexActionType::SetSleepOutfit; }
+		};
+
+		// Bounds are shared by both stacks. Cost is counted in deltas + spawned handles, so a
+		// single remove-all on a large inventory can push older entries out.
+		static constexpr size_t MAX_ENTRIES = 32;
+		static constexpr size_t MAX_COST = 16384;
+
+		void Record(Entry&& a_entry);
+		bool Undo();
+		bool Redo();
+		void Clear();
+
+		bool CanUndo() const;
+		bool CanRedo() const;
+		bool IsBusy() const { return m_busy.load(std::memory_order_acquire); }
+
+	private:
+		void Trim();
+		void Finish(Entry&& a_entry, bool a_undone);
+		void SwapOutfit(std::shared_ptr<Entry> a_entry, RE::NiPointer<RE::TESObjectREFR> a_target, bool a_undone);
+		bool Take(std::deque<Entry>& a_stack, Entry& a_entry, RE::NiPointer<RE::TESObjectREFR>& a_target);
+
+		mutable ExclusiveLock m_lock;
+		std::deque<Entry>     m_undo;
+		std::deque<Entry>     m_redo;
+		size_t                m_cost = 0;
+		std::atomic<bool>     m_busy{ false };
+	};
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <functional>
 
 #include "RE/B/BSContainer.h"
@@ -10,6 +12,8 @@
 #include "localization/Locale.h"
 #include "ui/core/UIManager.h"
 #include "config/UserData.h"
+#include "core/CommandJournal.h"
+#include "core/TaskScheduler.h"
 
 // TODO: Implement requested Papyrus API for some handlers.
 
@@ -114,6 +118,21 @@ namespace Modex::Commands
 		}
 	}
 
+	// Bumped once per completed batch. Inventory tables compare against it when drawn rather than
+	// the batch holding a callback into UI objects that may be gone by the time it finishes.
+	inline std::atomic<uint32_t> InventoryRevision{ 0 };
+
+	// Running totals for batch commands, read by the table profiler in developer mode.
+	struct BatchStats {
+		std::atomic<uint32_t> batches{ 0 };
+		std::atomic<uint32_t> tasks{ 0 };
+		std::atomic<uint32_t> items{ 0 };
+		std::atomic<uint32_t> events{ 0 };
+		std::atomic<float>    lastBatchMs{ 0.0f };
+	};
+
+	inline BatchStats Stats;
+
 	struct ResolvedItem {
 		RE::TESBoundObject* object;
 		uint16_t       count;
@@ -190,18 +209,49 @@ namespace Modex::Commands
 		return result;
 	}
 
-	// Returns a deterministic estimate of a leveled list's value by walking
-	// entries statically rather than using engine RNG resolution. Takes the max
-	// value of any single entry (or sums all if UseAll flag is set) so the
-	// result is stable across frames and can't be cheesed by re-rolling.
-	static inline int GetProjectedLeveledListValue(const RE::TESLeveledList* a_list)
+	// Memoized results for GetProjectedLeveledListValue and GetOutfitValue. The projection walks
+	// entries statically (no RNG, no level gating), so a list's value depends only on the list.
+	// Modex never edits leveled lists, so entries live until the cache is cleared on data load.
+	// cyclicRoots holds top-level results of walks that cut a cycle; they are only valid as the
+	// answer for that starting list, so nested walks never read them. cyclic holds the lists that
+	// closed a cycle, so each one is reported once.
+	struct ValueCache {
+		ExclusiveLock                                      lock;
+		std::unordered_map<const RE::TESLeveledList*, int> lists;
+		std::unordered_map<const RE::TESLeveledList*, int> cyclicRoots;
+		std::unordered_map<const RE::BGSOutfit*, int>      outfits;
+		std::unordered_set<const RE::TESLeveledList*>      cyclic;
+	};
+
+	inline ValueCache LeveledValueCache;
+
+	// Assumes LeveledValueCache.lock is held. a_stack holds the lists currently being resolved;
+	// meeting one of them again means the plugin data contains a cycle, which contributes 0 and
+	// sets a_cyclic. A value that depended on a cut cycle is only a partial sum for whichever list
+	// the walk started from, so it is not cached here; callers cache it as a root result.
+	static inline int ResolveLeveledListValue(const RE::TESLeveledList* a_list, std::vector<const RE::TESLeveledList*>& a_stack, bool& a_cyclic)
 	{
 		if (!a_list || a_list->entries.empty()) return 0;
 
+		if (auto it = LeveledValueCache.lists.find(a_list); it != LeveledValueCache.lists.end()) {
+			return it->second;
+		}
+
+		if (std::find(a_stack.begin(), a_stack.end(), a_list) != a_stack.end()) {
+			if (LeveledValueCache.cyclic.insert(a_list).second) {
+				Warn("Cyclic leveled list reference detected while projecting value.");
+			}
+			a_cyclic = true;
+			return 0;
+		}
+
+		a_stack.push_back(a_list);
+
 		const bool useAll = (a_list->llFlags & RE::TESLeveledList::Flag::kUseAll) != 0;
 
 		int maxValue = 0;
 		int sumValue = 0;
+		bool cyclic = false;
 
 		for (auto& entry : a_list->entries) {
 			if (!entry.form) continue;
@@ -210,7 +260,7 @@ namespace Modex::Commands
 
 			if (entry.form->GetFormType() == RE::FormType::LeveledItem) {
 				if (auto nested = entry.form->As<RE::TESLeveledList>()) {
-					entryValue = GetProjectedLeveledListValue(nested) * entry.count;
+					entryValue = ResolveLeveledListValue(nested, a_stack, cyclic) * entry.count;
 				}
 			} else {
 				if (auto bound = entry.form->As<RE::TESBoundObject>()) {
@@ -224,7 +274,42 @@ namespace Modex::Commands
 			}
 		}
 
-		return useAll ? sumValue : maxValue;
+		a_stack.pop_back();
+
+		const int value = useAll ? sumValue : maxValue;
+
+		if (cyclic) {
+			a_cyclic = true;
+		} else {
+			LeveledValueCache.lists[a_list] = value;
+		}
+
+		return value;
+	}
+
+	// Returns a deterministic estimate of a leveled list's value by walking
+	// entries statically rather than using engine RNG resolution. Takes the max
+	// value of any single entry (or sums all if UseAll flag is set) so the
+	// result is stable across frames and can't be cheesed by re-rolling.
+	static inline int GetProjectedLeveledListValue(const RE::TESLeveledList* a_list)
+	{
+		if (!a_list || a_list->entries.empty()) return 0;
+
+		Locker locker(LeveledValueCache.lock);
+
+		if (auto it = LeveledValueCache.cyclicRoots.find(a_list); it != LeveledValueCache.cyclicRoots.end()) {
+			return it->second;
+		}
+
+		std::vector<const RE::TESLeveledList*> stack;
+		bool cyclic = false;
+		const int value = ResolveLeveledListValue(a_list, stack, cyclic);
+
+		if (cyclic) {
+			LeveledValueCache.cyclicRoots[a_list] = value;
+		}
+
+		return value;
 	}
 
 	static inline int GetOutfitValue(const RE::BGSOutfit* a_outfit, uint16_t a_level = 0)
@@ -232,7 +317,15 @@ namespace Modex::Commands
 		(void)a_level;
 		if (!a_outfit || a_outfit->outfitItems.size() == 0) return 0;
 
+		Locker locker(LeveledValueCache.lock);
+
+		if (auto it = LeveledValueCache.outfits.find(a_outfit); it != LeveledValueCache.outfits.end()) {
+			return it->second;
+		}
+
 		int value = 0;
+		bool cyclic = false;
+		std::vector<const RE::TESLeveledList*> stack;
 
 		a_outfit->ForEachItem([&](RE::TESForm* a_form) {
 			if (!a_form)
@@ -240,7 +333,7 @@ namespace Modex::Commands
 
 			if (a_form->GetFormType() == RE::FormType::LeveledItem) {
 				if (auto leveledList = a_form->As<RE::TESLeveledList>()) {
-					value += GetProjectedLeveledListValue(leveledList);
+					value += ResolveLeveledListValue(leveledList, stack, cyclic);
 				}
 			} else {
 				if (auto bound = a_form->As<RE::TESBoundObject>()) {
@@ -251,9 +344,20 @@ namespace Modex::Commands
 			return RE::BSContainer::ForEachResult::kContinue;
 		});
 
+		// An outfit is always the root of its walk, so even a total that cut a cycle is stable.
+		LeveledValueCache.outfits[a_outfit] = value;
 		return value;
 	}
 
+	static inline void ClearLeveledValueCache()
+	{
+		Locker locker(LeveledValueCache.lock);
+		LeveledValueCache.lists.clear();
+		LeveledValueCache.cyclicRoots.clear();
+		LeveledValueCache.outfits.clear();
+		LeveledValueCache.cyclic.clear();
+	}
+
 	static inline const std::vector<BaseObject> GetOutfitItems(const RE::BGSOutfit* a_outfit, uint16_t a_level = 0)
 	{
 		if (!a_outfit || a_outfit->outfitItems.size() == 0) return {};
@@ -288,6 +392,23 @@ namespace Modex::Commands
 		return m_inventory;
 	}
 
+	// Journals the items a leveled list or outfit resolved to as a single undoable entry.
+	static inline void RecordResolvedItems(ModexActionType a_action, Ownership a_owner, RE::TESObjectREFR* a_targetRef, const std::vector<ResolvedItem>& a_items)
+	{
+		std::vector<CommandJournal::Delta> deltas;
+		deltas.reserve(a_items.size());
+
+		for (const auto& entry : a_items) {
+			if (entry.object && entry.count > 0) {
+				deltas.push_back({ entry.object->GetFormID(), entry.count });
+			}
+		}
+
+		if (!deltas.empty()) {
+			CommandJournal::GetSingleton()->Record({ a_action, a_owner, a_targetRef->CreateRefHandle(), std::move(deltas), {} });
+		}
+	}
+
 	static inline void AddItemToInventory(Ownership a_owner, RE::TESObjectREFR* a_targetRef, RE::FormID a_item, uint32_t a_amount = 1)
 	{
 		if (!a_targetRef)
@@ -305,6 +426,7 @@ namespace Modex::Commands
 				return;
 
 			a_targetRef->AddObjectToContainer(boundObject, nullptr, a_amount, nullptr);
+			CommandJournal::GetSingleton()->Record({ ModexActionType::AddItem, a_owner, a_targetRef->CreateRefHandle(), { { boundObject->GetFormID(), a_amount } }, {} });
 			UserData::SendEvent(ModexActionType::AddItem, a_item, a_owner);
 		});
 	}
@@ -326,6 +448,7 @@ namespace Modex::Commands
 				return;
 
 			a_targetRef->AddObjectToContainer(boundObject, nullptr, a_amount, nullptr);
+			CommandJournal::GetSingleton()->Record({ ModexActionType::AddItem, a_owner, a_targetRef->CreateRefHandle(), { { boundObject->GetFormID(), a_amount } }, {} });
 			UserData::SendEvent(ModexActionType::AddItem, a_editorID, a_owner);
 		});
 	}
@@ -347,12 +470,19 @@ namespace Modex::Commands
 			if (auto leveled = RE::TESForm::LookupByEditorID<RE::TESLeveledList>(a_editorID)) {
 				auto resolved = ResolveLeveledList(leveled, a_targetRef, a_amount);
 
+				std::vector<RE::TESForm*> added;
+				uint32_t quantity = 0;
+
 				for (auto& entry : resolved) {
 					a_targetRef->AddObjectToContainer(entry.object, nullptr, entry.count, nullptr);
-
-					auto editorid = po3_GetEditorID(entry.object->GetFormID());
-					UserData::SendEvent(ModexActionType::AddItem, editorid, a_owner);
+					added.push_back(entry.object);
+					quantity += entry.count;
 				}
+
+				RecordResolvedItems(ModexActionType::AddItem, a_owner, a_targetRef, resolved);
+
+				// Notifications merge per target, so summarize the roll instead of one row per entry.
+				UserData::SendBatchEvent(ModexActionType::AddItem, added, quantity, a_targetRef, a_owner);
 			}
 		});
 	}
@@ -366,12 +496,19 @@ namespace Modex::Commands
 			if (auto leveled = RE::TESForm::LookupByID<RE::TESLeveledList>(a_formID)) {
 				auto resolved = ResolveLeveledList(leveled, a_targetRef, a_amount);
 
+				std::vector<RE::TESForm*> added;
+				uint32_t quantity = 0;
+
 				for (auto& entry : resolved) {
 					a_targetRef->AddObjectToContainer(entry.object, nullptr, entry.count, nullptr);
-
-					auto editorid = po3_GetEditorID(entry.object->GetFormID());
-					UserData::SendEvent(ModexActionType::AddItem, editorid, a_owner);
+					added.push_back(entry.object);
+					quantity += entry.count;
 				}
+
+				RecordResolvedItems(ModexActionType::AddItem, a_owner, a_targetRef, resolved);
+
+				// Notifications merge per target, so summarize the roll instead of one row per entry.
+				UserData::SendBatchEvent(ModexActionType::AddItem, added, quantity, a_targetRef, a_owner);
 			}
 		});
 	}
@@ -382,14 +519,28 @@ namespace Modex::Commands
 			return;
 
 		SKSE::GetTaskInterface()->AddTask([a_owner, a_targetRef]() {
+			std::vector<RE::TESForm*> removed;
+			std::vector<CommandJournal::Delta> deltas;
+			uint32_t quantity = 0;
+
 			auto inventory = a_targetRef->GetInventory();
 			for (auto& [obj, data] : inventory) {
 				auto& [count, entry] = data;
 				if (count > 0 && entry) {
 					a_targetRef->RemoveItem(obj, count, RE::ITEM_REMOVE_REASON::kRemove, nullptr, nullptr);
-					UserData::SendEvent(ModexActionType::RemoveItem, po3_GetEditorID(obj->GetFormID()), a_owner);
+					removed.push_back(obj);
+					deltas.push_back({ obj->GetFormID(), static_cast<uint32_t>(count) });
+					quantity += static_cast<uint32_t>(count);
 				}
 			}
+
+			if (!deltas.empty()) {
+				CommandJournal::GetSingleton()->Record({ ModexActionType::RemoveItem, a_owner, a_targetRef->CreateRefHandle(), std::move(deltas), {} });
+			}
+
+			// One summarized event instead of an EditorID round-trip and notification per stack.
+			InventoryRevision.fetch_add(1, std::memory_order_relaxed);
+			UserData::SendBatchEvent(ModexActionType::RemoveItem, removed, quantity, a_targetRef, a_owner);
 		});
 	}
 
@@ -409,7 +560,17 @@ namespace Modex::Commands
 			if (!boundObject)
 				return;
 
+			// Journal only what the target actually held, so undo never hands back more.
+			const auto counts = a_targetRef->GetInventoryCounts([boundObject](const RE::TESBoundObject& a_object) { return &a_object == boundObject; });
+			const auto held = counts.find(boundObject);
+			const uint32_t removed = held != counts.end() && held->second > 0 ? (std::min)(a_amount, static_cast<uint32_t>(held->second)) : 0;
+
 			a_targetRef->RemoveItem(boundObject, a_amount, RE::ITEM_REMOVE_REASON::kRemove, nullptr, nullptr);
+
+			if (removed > 0) {
+				CommandJournal::GetSingleton()->Record({ ModexActionType::RemoveItem, a_owner, a_targetRef->CreateRefHandle(), { { boundObject->GetFormID(), removed } }, {} });
+			}
+
 			UserData::SendEvent(ModexActionType::RemoveItem, a_editorID, a_owner);
 		});
 	}
@@ -520,6 +681,7 @@ namespace Modex::Commands
 				return;
 
 			a_targetRef->AddObjectToContainer(boundObject, nullptr, a_amount, nullptr);
+			CommandJournal::GetSingleton()->Record({ ModexActionType::EquipItem, a_owner, a_targetRef->CreateRefHandle(), { { boundObject->GetFormID(), a_amount } }, {} });
 			UserData::SendEvent(ModexActionType::AddItem, a_editorID, a_owner);
 
 			auto actor = a_targetRef->As<RE::Actor>();
@@ -539,6 +701,287 @@ namespace Modex::Commands
 		});
 	}
 
+	// A form resolved on the UI side, paired with the amount to apply. Batch commands take these
+	// directly so the game task never round-trips through EditorID lookups.
+	struct BatchItem {
+		RE::TESBoundObject* object;
+		uint32_t            count;
+		bool                equip = false;  // Add: also wear it, so a kit can mix both in one batch
+	};
+
+	enum class BatchAction : uint8_t {
+		Add,
+		Remove,
+		Equip,
+		Place
+	};
+
+	// Each scheduler step applies at least BATCH_MIN_CHUNK items, then keeps going until the frame
+	// budget is spent. Placing a reference costs far more than an inventory change, so PlaceAtMe
+	// steps one reference at a time and only guarantees one per step.
+	static constexpr size_t BATCH_MIN_CHUNK = 16;
+	static constexpr size_t PLACE_MIN_CHUNK = 1;
+
+	// Invoked instead of the journal and notification when a batch is replaying journal entries.
+	struct BatchState;
+	using BatchCallback = std::function<void(BatchState&)>;
+
+	struct BatchState {
+		Ownership                                       owner;
+		RE::TESObjectREFR*                              targetRef;
+		BatchAction                                     action;
+		std::vector<BatchItem>                          items;
+		std::vector<RE::TESForm*>                       applied;
+		std::vector<CommandJournal::Delta>              deltas;
+		std::vector<RE::ObjectRefHandle>                spawned;
+		std::unordered_map<RE::TESBoundObject*, int32_t> available;
+		BatchCallback                                   onComplete;
+		size_t                                          next = 0;
+		uint32_t                                        cursor = 0;  // Place: units of items[next] attempted
+		uint32_t                                        placed = 0;  // Place: units of items[next] spawned
+		bool                                            persistent = true;
+		bool                                            disabled = false;
+		float                                           elapsedMs = 0.0f;
+	};
+
+	// Returns the amount actually applied. Removals are clamped to the counts snapshotted when the
+	// batch started, so the journal never restores more than the target really had.
+	static inline uint32_t ApplyBatchItem(BatchState& a_state, const BatchItem& a_item)
+	{
+		switch (a_state.action) {
+		case BatchAction::Add:
+			a_state.targetRef->AddObjectToContainer(a_item.object, nullptr, a_item.count, nullptr);
+
+			if (a_item.equip) {
+				if (auto actor = a_state.targetRef->As<RE::Actor>()) {
+					actor->AddWornItem(a_item.object, 1, false, 0, 0);
+				}
+			}
+			return a_item.count;
+		case BatchAction::Remove:
+		{
+			auto it = a_state.available.find(a_item.object);
+			if (it == a_state.available.end() || it->second <= 0)
+				return 0;
+
+			const uint32_t count = (std::min)(a_item.count, static_cast<uint32_t>(it->second));
+			it->second -= static_cast<int32_t>(count);
+
+			a_state.targetRef->RemoveItem(a_item.object, count, RE::ITEM_REMOVE_REASON::kRemove, nullptr, nullptr);
+			return count;
+		}
+		case BatchAction::Equip:
+			a_state.targetRef->AddObjectToContainer(a_item.object, nullptr, a_item.count, nullptr);
+
+			// The object was just added, so it is the inventory entry; no need to search for it.
+			if (auto actor = a_state.targetRef->As<RE::Actor>()) {
+				actor->AddWornItem(a_item.object, 1, false, 0, 0);
+			}
+			return a_item.count;
+		case BatchAction::Place:
+			// One reference per call: PlaceAtMe only returns the last reference it spawns, and undo
+			// needs a handle for each. RunBatchChunk walks the item's count through BatchState::cursor.
+			if (auto ref = Papyrus_PlaceAtMe(a_state.targetRef, a_item.object, 1, a_state.persistent, a_state.disabled)) {
+				a_state.spawned.push_back(ref->CreateRefHandle());
+				return 1;
+			}
+			return 0;
+		}
+
+		return 0;
+	}
+
+	static inline ModexActionType GetBatchActionType(BatchAction a_action)
+	{
+		switch (a_action) {
+		case BatchAction::Remove: return ModexActionType::RemoveItem;
+		case BatchAction::Equip:  return ModexActionType::EquipItem;
+		case BatchAction::Place:  return ModexActionType::PlaceAtMe;
+		default:                  return ModexActionType::AddItem;
+		}
+	}
+
+	// Returns true once the batch has finished.
+	static inline bool RunBatchChunk(const std::shared_ptr<BatchState>& a_state)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		const size_t minChunk = a_state->action == BatchAction::Place ? PLACE_MIN_CHUNK : BATCH_MIN_CHUNK;
+		size_t processed = 0;
+
+		Stats.tasks.fetch_add(1, std::memory_order_relaxed);
+
+		while (a_state->next < a_state->items.size()) {
+			const auto& item = a_state->items[a_state->next];
+
+			if (!item.object || item.count == 0) {
+				++a_state->next;
+				continue;
+			}
+
+			uint32_t count = ApplyBatchItem(*a_state, item);
+
+			// Place spawns one unit per step, so a large count can still yield between references.
+			// The item only completes, and is journaled as a single delta, once its count is spent.
+			if (a_state->action == BatchAction::Place) {
+				a_state->placed += count;
+
+				if (++a_state->cursor < item.count) {
+					if (++processed >= minChunk && TaskScheduler::GetSingleton()->ShouldYield()) {
+						break;
+					}
+					continue;
+				}
+
+				count = std::exchange(a_state->placed, 0);
+				a_state->cursor = 0;
+			}
+
+			++a_state->next;
+
+			if (count > 0) {
+				a_state->applied.push_back(item.object);
+				a_state->deltas.push_back({ item.object->GetFormID(), count, item.equip });
+			}
+
+			if (++processed >= minChunk && TaskScheduler::GetSingleton()->ShouldYield()) {
+				break;
+			}
+		}
+
+		a_state->elapsedMs += std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+		Stats.items.fetch_add(static_cast<uint32_t>(processed), std::memory_order_relaxed);
+
+		if (a_state->next < a_state->items.size()) {
+			return false;
+		}
+
+		if (a_state->action != BatchAction::Place) {
+			InventoryRevision.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		Stats.batches.fetch_add(1, std::memory_order_relaxed);
+		Stats.events.fetch_add(a_state->applied.empty() ? 0 : 1, std::memory_order_relaxed);
+		Stats.lastBatchMs.store(a_state->elapsedMs, std::memory_order_relaxed);
+
+		if (a_state->onComplete) {
+			a_state->onComplete(*a_state);
+			return true;
+		}
+
+		uint32_t quantity = 0;
+		for (const auto& delta : a_state->deltas) {
+			quantity += delta.count;
+		}
+
+		if (!a_state->deltas.empty()) {
+			CommandJournal::GetSingleton()->Record({
+				GetBatchActionType(a_state->action),
+				a_state->owner,
+				a_state->action == BatchAction::Place ? RE::ObjectRefHandle() : a_state->targetRef->CreateRefHandle(),
+				std::move(a_state->deltas),
+				std::move(a_state->spawned)
+			});
+		}
+
+		UserData::SendBatchEvent(GetBatchActionType(a_state->action), a_state->applied, quantity, a_state->targetRef, a_state->owner);
+		return true;
+	}
+
+	// Applies a whole selection as a single background job (split across frames only when over
+	// budget), with one inventory revision bump and one notification at the end. The persistent
+	// and disabled flags only apply to Place.
+	static inline void RunBatch(Ownership a_owner, RE::TESObjectREFR* a_targetRef, BatchAction a_action, std::vector<BatchItem> a_items, BatchCallback a_onComplete = nullptr, bool a_persistent = true, bool a_disabled = false)
+	{
+		auto state = std::make_shared<BatchState>();
+		state->owner = a_owner;
+		state->persistent = a_persistent;
+		state->disabled = a_disabled;
+		state->targetRef = a_targetRef;
+		state->action = a_action;
+		state->items = std::move(a_items);
+		state->onComplete = std::move(a_onComplete);
+		state->applied.reserve(state->items.size());
+		state->deltas.reserve(state->items.size());
+
+		// Replays still need their callback so the journal can settle, even when nothing applies.
+		if (state->items.empty() || (!a_targetRef && a_action != BatchAction::Place)) {
+			if (state->onComplete) state->onComplete(*state);
+			return;
+		}
+
+		TaskScheduler::GetSingleton()->Submit(TaskScheduler::Priority::Background, [state, started = false]() mutable {
+			if (!started) {
+				started = true;
+
+				if (state->action == BatchAction::Place) {
+					state->targetRef = GetPlayerReference();
+
+					if (!state->targetRef) {
+						if (state->onComplete) state->onComplete(*state);
+						return true;
+					}
+				}
+
+				if (state->action == BatchAction::Remove) {
+					for (auto& [object, count] : state->targetRef->GetInventoryCounts()) {
+						state->available[object] = count;
+					}
+				}
+			}
+
+			return RunBatchChunk(state);
+		});
+	}
+
+	// Disables and deletes references spawned by PlaceAtMe as a background job, sharing the frame
+	// budget with RunBatch. Handles that no longer resolve (cell reset, already deleted) are skipped.
+	static inline void DeleteReferences(std::vector<RE::ObjectRefHandle> a_refs, std::function<void()> a_onComplete)
+	{
+		auto refs = std::make_shared<std::vector<RE::ObjectRefHandle>>(std::move(a_refs));
+
+		TaskScheduler::GetSingleton()->Submit(TaskScheduler::Priority::Background, [refs, a_onComplete, next = size_t(0)]() mutable {
+			size_t processed = 0;
+
+			while (next < refs->size()) {
+				if (auto ref = (*refs)[next++].get()) {
+					ref->Disable();
+					ref->SetDelete(true);
+				}
+
+				if (++processed >= BATCH_MIN_CHUNK && TaskScheduler::GetSingleton()->ShouldYield()) {
+					break;
+				}
+			}
+
+			if (next < refs->size()) {
+				return false;
+			}
+
+			if (a_onComplete) a_onComplete();
+			return true;
+		});
+	}
+
+	static inline void AddItemsToInventory(Ownership a_owner, RE::TESObjectREFR* a_targetRef, std::vector<BatchItem> a_items)
+	{
+		RunBatch(a_owner, a_targetRef, BatchAction::Add, std::move(a_items));
+	}
+
+	static inline void RemoveItemsFromInventory(Ownership a_owner, RE::TESObjectREFR* a_targetRef, std::vector<BatchItem> a_items)
+	{
+		RunBatch(a_owner, a_targetRef, BatchAction::Remove, std::move(a_items));
+	}
+
+	static inline void AddAndEquipItemsToInventory(Ownership a_owner, RE::TESObjectREFR* a_targetRef, std::vector<BatchItem> a_items)
+	{
+		RunBatch(a_owner, a_targetRef, BatchAction::Equip, std::move(a_items));
+	}
+
+	static inline void PlaceItemsAtMe(Ownership a_owner, std::vector<BatchItem> a_items)
+	{
+		RunBatch(a_owner, nullptr, BatchAction::Place, std::move(a_items));
+	}
+
 	static inline void AddAndEquipItemToPlayerInventory(Ownership a_owner, const std::string& a_editorID)
 	{
 		auto player = RE::PlayerCharacter::GetSingleton();
@@ -680,6 +1123,7 @@ namespace Modex::Commands
 				a_targetRef->AddObjectToContainer(entry.object, nullptr, entry.count, nullptr);
 			}
 
+			RecordResolvedItems(ModexActionType::AddOutfit, a_owner, a_targetRef, resolved);
 			UserData::SendEvent(ModexActionType::AddItem, po3_GetEditorID(a_outfit->GetFormID()), a_owner);
 		});
 	}
@@ -698,6 +1142,8 @@ namespace Modex::Commands
 				a_targetRef->AddObjectToContainer(entry.object, nullptr, entry.count, nullptr);
 			}
 
+			RecordResolvedItems(ModexActionType::EquipOutfit, a_owner, a_targetRef, resolved);
+
 			auto actor = a_targetRef->As<RE::Actor>();
 			if (!actor)
 				return;
@@ -725,7 +1171,9 @@ namespace Modex::Commands
 		SKSE::GetTaskInterface()->AddTask([a_owner, a_targetRef, a_outfit]() {
 			if (auto npc = a_targetRef->As<RE::Actor>()) {
 				if (auto base = npc->GetActorBase()) {
+					const RE::FormID previous = base->sleepOutfit ? base->sleepOutfit->GetFormID() : 0;
 					base->sleepOutfit = a_outfit;
+					CommandJournal::GetSingleton()->Record({ ModexActionType::SetSleepOutfit, a_owner, a_targetRef->CreateRefHandle(), {}, {}, previous });
 				}
 			}
 
@@ -741,7 +1189,9 @@ namespace Modex::Commands
 		SKSE::GetTaskInterface()->AddTask([a_owner, a_targetRef, a_outfit]() {
 			if (auto npc = a_targetRef->As<RE::Actor>()) {
 				if (auto base = npc->GetActorBase()) {
+					const RE::FormID previous = base->defaultOutfit ? base->defaultOutfit->GetFormID() : 0;
 					base->defaultOutfit = a_outfit;
+					CommandJournal::GetSingleton()->Record({ ModexActionType::SetDefaultOutfit, a_owner, a_targetRef->CreateRefHandle(), {}, {}, previous });
 				}
 			}
 
@@ -749,29 +1199,21 @@ namespace Modex::Commands
 		});
 	}
 
+	// Runs through the batch scheduler like a selection, so a large count spreads across frames
+	// and every spawned reference is journaled.
 	static inline void PlaceAtMe(Ownership a_owner, const std::string& a_editorID, uint32_t a_count = 1, bool persistent = true, bool disabled = false)
 	{
-		if (a_editorID.empty())
+		if (a_editorID.empty() || a_count == 0)
 			return;
 
-		SKSE::GetTaskInterface()->AddTask([a_owner, a_editorID, a_count, persistent, disabled]() {
-			auto player = RE::PlayerCharacter::GetSingleton();
-			if (!player)
-				return;
+		auto object = RE::TESForm::LookupByEditorID<RE::TESBoundObject>(a_editorID);
 
-			auto target = player->AsReference();
-			if (!target)
-				return;
+		if (!object) {
+			Error("PlaceAtMe: '{}' does not resolve to a placeable form.", a_editorID);
+			return;
+		}
 
-			if (RE::TESForm* object = RE::TESForm::LookupByEditorID(a_editorID); object) {
-				auto newObject = Papyrus_PlaceAtMe(target, object, a_count, persistent, disabled);
-				if (newObject) {
-					UserData::SendEvent(ModexActionType::PlaceAtMe, newObject->GetFormID(), a_owner);
-				} else {
-					Error("Failed to resolve new object from Papyrus_PlaceAtMe func: {}", a_editorID);
-				}
-			}
-		});
+		RunBatch(a_owner, nullptr, BatchAction::Place, { { object, a_count } }, nullptr, persistent, disabled);
 	}
 
 	static inline void KillRefr(Ownership a_owner, RE::TESObjectREFR* a_targetRef)
@@ -2,11 +2,12 @@
 
 #include "Graphic.h"
 #include "config/Keycodes.h"
+#include "core/WorkerPool.h"
 #include "external/stb_image.h"
 
 namespace Modex
 {
-	bool GraphicManager::GetD3D11Texture(const char* filename, ID3D11ShaderResourceView** out_srv, int& out_width, int& out_height)
+	GraphicManager::D3D11View GraphicManager::CreateTexture(const uint8_t* a_pixels, int32_t a_width, int32_t a_height)
 	{
 		const auto* renderer = RE::BSGraphics::Renderer::GetSingleton();
 		ASSERT_MSG(renderer == nullptr, "Failed to get BSGraphics Renderer!");
@@ -17,32 +18,16 @@ namespace Modex
 		auto *device    = reinterpret_cast<ID3D11Device *>(renderData.forwarder);
 
 		if (!device) {
-			Error("D3D11 Device is null, cannot create texture for image: '{}'", filename);
-			return false;
-		}
-
-		auto* render_manager = RE::BSGraphics::Renderer::GetSingleton();
-		if (!render_manager) {
-			Error("Cannot find RE::BSGraphics::Renderer singleton. Uh oh!");
-			return false;
-		}
-
-		// Load from disk into a buffer
-		int image_width = 0;
-		int image_height = 0;
-		unsigned char* image_data = stbi_load(filename, &image_width, &image_height, NULL, 4);
-
-		if (image_data == NULL) {
-			Error("Failed to load image: '{}'", filename);
-			return false;
+			Error("D3D11 Device is null, cannot create texture.");
+			return nullptr;
 		}
 
 		// Create texture
 		D3D11_TEXTURE2D_DESC desc;
 		ZeroMemory(&desc, sizeof(desc));
 
-		desc.Width = image_width;
-		desc.Height = image_height;
+		desc.Width = a_width;
+		desc.Height = a_height;
 		desc.MipLevels = 1;
 		desc.ArraySize = 1;
 		desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
@@ -54,11 +39,14 @@ namespace Modex
 
 		ID3D11Texture2D* p_texture = nullptr;
 		D3D11_SUBRESOURCE_DATA sub_resource;
-		sub_resource.pSysMem = image_data;
+		sub_resource.pSysMem = a_pixels;
 		sub_resource.SysMemPitch = desc.Width * 4;
 		sub_resource.SysMemSlicePitch = 0;
 
-		device->CreateTexture2D(&desc, &sub_resource, &p_texture);
+		if (FAILED(device->CreateTexture2D(&desc, &sub_resource, &p_texture)) || !p_texture) {
+			Error("Failed to create {}x{} D3D11 texture.", a_width, a_height);
+			return nullptr;
+		}
 
 		// Create texture view
 		D3D11_SHADER_RESOURCE_VIEW_DESC srv_desc;
@@ -68,17 +56,181 @@ namespace Modex
 		srv_desc.Texture2D.MipLevels = desc.MipLevels;
 		srv_desc.Texture2D.MostDetailedMip = 0;
 
-		device->CreateShaderResourceView(p_texture, &srv_desc, out_srv);
+		D3D11View srv = nullptr;
+		device->CreateShaderResourceView(p_texture, &srv_desc, &srv);
 		p_texture->Release();
 
-		out_width = image_width;
-		out_height = image_height;
+		return srv;
+	}
+
+	bool GraphicManager::GetD3D11Texture(const char* filename, ID3D11ShaderResourceView** out_srv, int& out_width, int& out_height)
+	{
+		DecodedImage image;
+		if (!DecodeImage(filename, image)) {
+			Error("Failed to load image: '{}'", filename);
+			return false;
+		}
+
+		*out_srv = CreateTexture(image.pixels.data(), image.width, image.height);
+		out_width = image.width;
+		out_height = image.height;
+
+		return *out_srv != nullptr;
+	}
+
+	bool GraphicManager::DecodeImage(const std::filesystem::path& a_path, DecodedImage& a_out)
+	{
+		int image_width = 0;
+		int image_height = 0;
+		unsigned char* image_data = stbi_load(a_path.string().c_str(), &image_width, &image_height, NULL, 4);
+
+		if (image_data == NULL) {
+			return false;
+		}
+
+		a_out.width = image_width;
+		a_out.height = image_height;
+		a_out.pixels.assign(image_data, image_data + static_cast<size_t>(image_width) * image_height * 4);
 		stbi_image_free(image_data);
 
 		return true;
 	}
 
-	
+	// Shelf packing, tallest first. Images above ATLAS_ENTRY_MAX (logos, splash art) keep their
+	// own page so callers that sample them with custom UVs never bleed into a neighbour.
+	GraphicManager::PackedImages GraphicManager::PackImages(std::vector<DecodedImage>&& a_images)
+	{
+		PackedImages packed;
+		std::vector<size_t> order;
+
+		for (size_t i = 0; i < a_images.size(); i++) {
+			auto& image = a_images[i];
+
+			if (image.library == &imgui_library) {
+				packed.hasImGuiIcons = true;
+			}
+
+			if (image.pixels.empty()) {
+				continue;
+			}
+
+			if (image.width > ATLAS_ENTRY_MAX || image.height > ATLAS_ENTRY_MAX) {
+				packed.entries.push_back({ image.library, std::move(image.name), packed.pages.size(), 0, 0, image.width, image.height });
+				packed.pages.push_back({ image.width, image.height, std::move(image.pixels) });
+				continue;
+			}
+
+			order.push_back(i);
+		}
+
+		std::sort(order.begin(), order.end(), [&a_images](size_t a_lhs, size_t a_rhs) {
+			const auto& lhs = a_images[a_lhs];
+			const auto& rhs = a_images[a_rhs];
+			return lhs.height != rhs.height ? lhs.height > rhs.height : lhs.width > rhs.width;
+		});
+
+		// First pass places entries and sizes each page to what it actually uses.
+		const size_t first_atlas = packed.pages.size();
+		const size_t first_entry = packed.entries.size();
+		size_t page = SIZE_MAX;
+		int32_t x = 0, y = 0, shelf = 0;
+
+		for (const size_t i : order) {
+			auto& image = a_images[i];
+
+			if (page != SIZE_MAX && x + image.width > ATLAS_SIZE) {
+				x = 0;
+				y += shelf;
+				shelf = 0;
+			}
+
+			if (page == SIZE_MAX || y + image.height > ATLAS_SIZE) {
+				page = packed.pages.size();
+				packed.pages.emplace_back();
+				x = y = shelf = 0;
+			}
+
+			auto& target = packed.pages[page];
+			target.width = (std::max)(target.width, x + image.width);
+			target.height = (std::max)(target.height, y + image.height);
+
+			packed.entries.push_back({ image.library, std::move(image.name), page, x, y, image.width, image.height });
+
+			x += image.width + ATLAS_PADDING;
+			shelf = (std::max)(shelf, image.height + ATLAS_PADDING);
+		}
+
+		for (size_t i = first_atlas; i < packed.pages.size(); i++) {
+			auto& target = packed.pages[i];
+			target.pixels.assign(static_cast<size_t>(target.width) * target.height * 4, 0);
+		}
+
+		// Second pass copies rows into place; the entries are in the same order as `order`.
+		for (size_t i = 0; i < order.size(); i++) {
+			const auto& image = a_images[order[i]];
+			const auto& entry = packed.entries[first_entry + i];
+			auto& target = packed.pages[entry.page];
+
+			const size_t row_bytes = static_cast<size_t>(image.width) * 4;
+			for (int32_t row = 0; row < image.height; row++) {
+				std::memcpy(
+					target.pixels.data() + (static_cast<size_t>(entry.y + row) * target.width + entry.x) * 4,
+					image.pixels.data() + row * row_bytes,
+					row_bytes);
+			}
+		}
+
+		return packed;
+	}
+
+	// Runs once on the render thread after the workers finish; every texture is created here
+	// and the libraries are only touched from this thread.
+	void GraphicManager::UploadImages(PackedImages& a_packed)
+	{
+		std::vector<D3D11View> textures;
+		textures.reserve(a_packed.pages.size());
+
+		for (auto& page : a_packed.pages) {
+			textures.push_back(CreateTexture(page.pixels.data(), page.width, page.height));
+			page.pixels = {};
+		}
+
+		size_t loaded = 0;
+		for (const auto& entry : a_packed.entries) {
+			const auto& page = a_packed.pages[entry.page];
+			D3D11View texture = textures[entry.page];
+
+			if (!texture) {
+				Error("Failed to get D3D11 texture from image: {}", entry.name);
+				continue;
+			}
+
+			Image image;
+			image.texture = texture;
+			image.width = entry.width;
+			image.height = entry.height;
+			image.uv0 = ImVec2(static_cast<float>(entry.x) / page.width, static_cast<float>(entry.y) / page.height);
+			image.uv1 = ImVec2(static_cast<float>(entry.x + entry.width) / page.width, static_cast<float>(entry.y + entry.height) / page.height);
+
+			(*entry.library)[entry.name] = image;
+			loaded++;
+		}
+
+		Debug("Uploaded {} images in {} textures.", loaded, textures.size());
+
+		if (a_packed.hasImGuiIcons) {
+			bool success = GraphicManager::ValidateImGuiIcons();
+
+			// If we cannot validate a proper library of ImGuiIcons, sweep our local definitions and
+			// assume the user does not have it installed.
+
+			if (!success) {
+				imgui_library.clear();
+				Error("ImGuiIcon Libary failed to load properly. Disabling for compatibility!");
+			}
+		}
+	}
+
 	GraphicManager::Image GraphicManager::GetImage(std::string a_name)
 	{
 		auto found = image_library.find(a_name);
@@ -93,7 +245,7 @@ namespace Modex
 	std::string GraphicManager::GetImageName(Image a_image)
 	{
 		for (const auto& [key, value] : image_library) {
-			if (value.texture == a_image.texture) {
+			if (value.texture == a_image.texture && value.uv0.x == a_image.uv0.x && value.uv0.y == a_image.uv0.y) {
 				return key;
 			}
 		}
@@ -108,32 +260,6 @@ namespace Modex
 		return GraphicManager::image_library;
 	}
 
-	void GraphicManager::LoadImagesFromFilepath(const std::filesystem::path& a_path, std::map<std::string, Image>& out_struct)
-	{
-		ASSERT_MSG(!std::filesystem::exists(a_path), "Could not locate Image directory, expected at: {}", a_path.string());
-
-		for (const auto& entry : std::filesystem::directory_iterator(a_path)) {
-			if (entry.path().extension() != ".png") {
-				continue;
-			}
-
-			auto index = entry.path().stem().string();
-
-			bool success = GraphicManager::GetD3D11Texture(entry.path().string().c_str(), 
-				&out_struct[index].texture,
-				out_struct[index].width, 
-				out_struct[index].height);
-
-			if (!success) {
-				Error("Failed to get D3D11 texture from image: {}", entry.path().string());
-			} else {
-				Trace("Loaded image: '{}'", entry.path().string());
-			}
-		}
-
-		Debug("Loaded {} images from '{}'", out_struct.size(), a_path.string());
-	}
-
 	bool GraphicManager::ValidateImGuiIcons()
 	{
 		// Validate users local install of ImGuiIcon's matches our compiled map.
@@ -147,24 +273,87 @@ namespace Modex
 		return true;
 	}
 
+	// Decoding and packing run on the worker pool; the last job to finish hands the packed
+	// pages to the render thread, which creates every texture in one step. Until then the
+	// libraries only hold "None", and the keybind UI falls back to text.
 	void GraphicManager::Init()
 	{
 		image_library["None"] = Image();
-		GraphicManager::LoadImagesFromFilepath(GraphicManager::IMAGE_PATH, GraphicManager::image_library);
 
-		if (std::filesystem::exists(GraphicManager::IMGUI_PATH)) {
-			GraphicManager::LoadImagesFromFilepath(GraphicManager::IMGUI_PATH, GraphicManager::imgui_library);
-			bool success = GraphicManager::ValidateImGuiIcons();
+		ASSERT_MSG(!std::filesystem::exists(IMAGE_PATH), "Could not locate Image directory, expected at: {}", IMAGE_PATH.string());
 
-			// If we cannot validate a proper library of ImGuiIcons, sweep our local definitions and
-			// assume the user does not have it installed.
-
-			if (!success) {
-				imgui_library.clear();
-				Error("ImGuiIcon Libary failed to load properly. Disabling for compatibility!");
+		std::vector<std::pair<std::filesystem::path, Library*>> files;
+		const auto collect = [&files](const std::filesystem::path& a_path, Library& a_library) {
+			for (const auto& entry : std::filesystem::directory_iterator(a_path)) {
+				if (entry.path().extension() == ".png") {
+					files.emplace_back(entry.path(), &a_library);
+				}
 			}
+		};
+
+		collect(IMAGE_PATH, image_library);
+
+		if (std::filesystem::exists(GraphicManager::IMGUI_PATH)) {
+			collect(IMGUI_PATH, imgui_library);
 		} else {
 			Info("ImGui Icon Library mod/directory not found. Skipping Custom ImGui Library loading.");
 		}
+
+		if (files.empty()) {
+			return;
+		}
+
+		struct Batch
+		{
+			std::vector<DecodedImage>             images;
+			std::vector<std::filesystem::path>    paths;
+			std::atomic<size_t>                   remaining{ 0 };
+			std::chrono::steady_clock::time_point start;
+		};
+
+		auto batch = std::make_shared<Batch>();
+		batch->images.resize(files.size());
+		batch->paths.reserve(files.size());
+		batch->remaining.store(files.size(), std::memory_order_relaxed);
+		batch->start = std::chrono::steady_clock::now();
+
+		for (size_t i = 0; i < files.size(); i++) {
+			batch->images[i].library = files[i].second;
+			batch->images[i].name = files[i].first.stem().string();
+			batch->paths.push_back(files[i].first);
+		}
+
+		for (size_t i = 0; i < files.size(); i++) {
+			WorkerPool::GetSingleton()->Submit([batch, i]() {
+				DecodeImage(batch->paths[i], batch->images[i]);
+
+				if (batch->remaining.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+					return;
+				}
+
+				std::vector<std::string> failed;
+				for (size_t j = 0; j < batch->images.size(); j++) {
+					if (batch->images[j].pixels.empty()) {
+						failed.push_back(batch->paths[j].string());
+					}
+				}
+
+				auto packed = std::make_shared<PackedImages>(PackImages(std::move(batch->images)));
+				const auto start = batch->start;
+
+				WorkerPool::GetSingleton()->PostToMain([packed, failed = std::move(failed), start]() {
+					for (const auto& path : failed) {
+						Error("Failed to load image: '{}'", path);
+					}
+
+					UploadImages(*packed);
+
+					const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+					Debug("GraphicManager: Images ready {} ms after init.", elapsed.count());
+				});
+			});
+		}
+
+		Debug("GraphicManager: Queued {} images for decoding.", files.size());
 	}
 }
@@ -15,23 +15,77 @@ namespace Modex
 	public:
 		using D3D11View = ID3D11ShaderResourceView*;
 
+		// Small images share an atlas texture; uv0/uv1 locate the image inside it.
 		struct Image
 		{
 			D3D11View 					texture = nullptr;
 			int32_t 					width = 0;
 			int32_t 					height = 0;
+			ImVec2 						uv0 = ImVec2(0.0f, 0.0f);
+			ImVec2 						uv1 = ImVec2(1.0f, 1.0f);
+
+			// Maps a UV relative to this image onto the backing texture.
+			ImVec2 UV(float a_u, float a_v) const { return ImVec2(uv0.x + (uv1.x - uv0.x) * a_u, uv0.y + (uv1.y - uv0.y) * a_v); }
 		};
 
 		static inline std::map<std::string, GraphicManager::Image> image_library;
 		static inline std::map<std::string, GraphicManager::Image> imgui_library;
 
 		static void 		Init();
-		static void 		LoadImagesFromFilepath(const std::filesystem::path& a_path, std::map<std::string, Image>& out_struct);
 		static bool 		GetD3D11Texture(const char* filename, ID3D11ShaderResourceView** out_srv, int& out_width, int& out_height);
 		static bool 		ValidateImGuiIcons();
 
 		[[nodiscard]] static Image GetImage(std::string a_name);
 		[[nodiscard]] static std::string GetImageName(Image a_image);
 		[[nodiscard]] static std::map<std::string, Image> GetListOfImages();
+
+	private:
+		using Library = std::map<std::string, Image>;
+
+		static constexpr int32_t ATLAS_SIZE = 2048;
+		static constexpr int32_t ATLAS_ENTRY_MAX = 256;
+		static constexpr int32_t ATLAS_PADDING = 2;
+
+		struct DecodedImage
+		{
+			Library* 					library = nullptr;
+			std::string 				name;
+			int32_t 					width = 0;
+			int32_t 					height = 0;
+			std::vector<uint8_t> 		pixels;
+		};
+
+		// One texture's worth of RGBA pixels. Oversized images get a page to themselves.
+		struct AtlasPage
+		{
+			int32_t 					width = 0;
+			int32_t 					height = 0;
+			std::vector<uint8_t> 		pixels;
+		};
+
+		struct AtlasEntry
+		{
+			Library* 					library = nullptr;
+			std::string 				name;
+			size_t 						page = 0;
+			int32_t 					x = 0;
+			int32_t 					y = 0;
+			int32_t 					width = 0;
+			int32_t 					height = 0;
+		};
+
+		struct PackedImages
+		{
+			std::vector<AtlasPage> 		pages;
+			std::vector<AtlasEntry> 	entries;
+			bool 						hasImGuiIcons = false;
+		};
+
+		// CPU only: no D3D or engine calls, safe on worker threads.
+		static bool 		DecodeImage(const std::filesystem::path& a_path, DecodedImage& a_out);
+		static PackedImages PackImages(std::vector<DecodedImage>&& a_images);
+
+		static D3D11View 	CreateTexture(const uint8_t* a_pixels, int32_t a_width, int32_t a_height);
+		static void 		UploadImages(PackedImages& a_packed);
 	};
 }
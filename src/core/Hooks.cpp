@@ -1,5 +1,9 @@
 #include "core/Hooks.h"
 #include "core/InputManager.h"
+#include "core/TaskScheduler.h"
+#include "core/WorkerPool.h"
+#include "config/EquipmentConfig.h"
+#include "config/PersistenceService.h"
 #include "ui/core/UIManager.h"
 #include "ui/core/UIMenuImpl.h"
 #include <memory>
@@ -123,10 +127,28 @@ namespace Hooks
 
 	struct DXGIPresent_Hook
 	{
+		// Scheduler jobs mutate game state, so Present only queues a single SKSE task per frame to
+		// tick the scheduler on the game thread rather than stepping jobs here.
+		static inline std::atomic<bool> schedulerQueued{ false };
+
 		static void thunk(std::uint32_t a_p1)
 		{
 			func(a_p1);
 
+			// Completions from worker jobs land before this frame's UI and scheduler work.
+			Modex::WorkerPool::GetSingleton()->DrainMainQueue();
+			Modex::PersistenceService::GetSingleton()->Update();
+			Modex::EquipmentConfig::Update(Modex::UIManager::GetSingleton()->IsMenuOpen());
+
+			if (const auto& scheduler = Modex::TaskScheduler::GetSingleton(); scheduler->HasPending()) {
+				if (!schedulerQueued.exchange(true)) {
+					SKSE::GetTaskInterface()->AddTask([scheduler]() {
+						schedulerQueued.store(false);
+						scheduler->Tick();
+					});
+				}
+			}
+
 			if (const auto& inputManager = Modex::InputManager::GetSingleton(); inputManager != nullptr) {
 				inputManager->ProcessInputEvents();
 			}
@@ -3,6 +3,7 @@
 #include "data/BaseObject.h"
 #include "ui/core/UIManager.h"
 #include "core/Commands.h"
+#include "core/TaskScheduler.h"
 
 namespace Modex
 {
@@ -96,12 +97,17 @@ namespace Modex
 	{
 		if (!a_outfit) return;
 
-		// Frame 1: Spawn fresh container and populate it.
-		SKSE::GetTaskInterface()->AddTask([this, a_outfit, a_level]() {
+		// Step 1: Spawn fresh container and populate it. Critical, since the user is waiting on it.
+		TaskScheduler::GetSingleton()->Submit(TaskScheduler::Priority::Critical, [this, a_outfit, a_level, populated = false]() mutable {
+			if (populated) {
+				OpenChest();
+				return true;
+			}
+
 			auto container = SpawnChestReference();
 
 			if (!container)
-				return;
+				return true;
 
 			auto displayName = po3_GetEditorID(a_outfit->GetFormID());
 			container->SetDisplayName(displayName.c_str(), true);
@@ -112,10 +118,9 @@ namespace Modex
 				container->AddObjectToContainer(entry.object, nullptr, entry.count, nullptr);
 			}
 
-			// Frame 2: Open after engine processes inventory.
-			SKSE::GetTaskInterface()->AddTask([this]() {
-				OpenChest();
-			});
+			// Step 2: Open on the next tick, after the engine processes inventory.
+			populated = true;
+			return false;
 		});
 	}
 
@@ -126,25 +131,30 @@ namespace Modex
 		auto kitItems = a_kit.m_items;
 		auto kitSize = a_kit.m_items.size();
 
-		// Frame 1: Spawn fresh container and populate it.
-		SKSE::GetTaskInterface()->AddTask([this, kitName, kitKey, kitItems, kitSize]() {
+		// Step 1: Spawn fresh container and populate it.
+		TaskScheduler::GetSingleton()->Submit(TaskScheduler::Priority::Critical, [this, kitName, kitKey, kitItems, kitSize, populated = false]() mutable {
+			if (populated) {
+				OpenChest();
+				return true;
+			}
+
 			auto container = SpawnChestReference();
 
 			if (!container)
-				return;
+				return true;
 
 			container->SetDisplayName(kitName.c_str(), true);
 
 			int _count = 0;
-			for (auto& kitItem : kitItems) {
-				auto boundObject = RE::TESForm::LookupByEditorID(kitItem->m_editorid);
-				Trace("Adding Item '{}' from '{}' to PlayerChest container.", kitItem->m_editorid, kitKey);
+			for (const auto& kitItem : kitItems) {
+				auto boundObject = kitItem.GetForm();
+				Trace("Adding Item '{}' from '{}' to PlayerChest container.", kitItem.GetEditorID(), kitKey);
 
 				if (boundObject) {
 					container->AddObjectToContainer(
 						boundObject->As<RE::TESBoundObject>(),
 						nullptr,
-						static_cast<std::uint32_t>(kitItem->m_amount),
+						static_cast<std::uint32_t>(kitItem.m_amount),
 						nullptr
 					);
 
@@ -154,10 +164,9 @@ namespace Modex
 
 			Debug("Populated PlayerChest with '{}/{}' items from kit: '{}'", _count, kitSize, kitKey);
 
-			// Frame 2: Open after engine processes inventory.
-			SKSE::GetTaskInterface()->AddTask([this]() {
-				OpenChest();
-			});
+			// Step 2: Open on the next tick, after the engine processes inventory.
+			populated = true;
+			return false;
 		});
 	}
 
@@ -171,12 +180,17 @@ namespace Modex
 			editorIDs.push_back(item->GetEditorID());
 		}
 
-		// Frame 1: Spawn fresh container and populate it.
-		SKSE::GetTaskInterface()->AddTask([this, editorIDs = std::move(editorIDs)]() {
+		// Step 1: Spawn fresh container and populate it.
+		TaskScheduler::GetSingleton()->Submit(TaskScheduler::Priority::Critical, [this, editorIDs = std::move(editorIDs), populated = false]() mutable {
+			if (populated) {
+				OpenChest();
+				return true;
+			}
+
 			auto container = SpawnChestReference();
 
 			if (!container)
-				return;
+				return true;
 
 			container->SetDisplayName("Modex", true);
 
@@ -199,10 +213,9 @@ namespace Modex
 
 			Debug("Populated PlayerChest with '{}/{}' items from Table.", _count, editorIDs.size());
 
-			// Frame 2: Open after engine processes inventory.
-			SKSE::GetTaskInterface()->AddTask([this]() {
-				OpenChest();
-			});
+			// Step 2: Open on the next tick, after the engine processes inventory.
+			populated = true;
+			return false;
 		});
 	}
 }
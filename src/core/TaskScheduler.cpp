@@ -0,0 +1,67 @@
+#include "TaskScheduler.h"
+
+namespace Modex
+{
+	TaskScheduler::TaskScheduler(Clock a_clock)
+		: m_clock(a_clock ? std::move(a_clock) : Clock([]() { return std::chrono::steady_clock::now(); }))
+	{}
+
+	void TaskScheduler::Submit(Priority a_priority, Step a_step)
+	{
+		if (!a_step)
+			return;
+
+		Locker locker(m_lock);
+		m_incoming.emplace_back(a_priority, std::move(a_step));
+		m_stats.pending.fetch_add(1, std::memory_order_release);
+	}
+
+	bool TaskScheduler::ShouldYield() const
+	{
+		return m_clock() >= m_deadline;
+	}
+
+	// Steps each job at most once, front to back. Jobs past a_guaranteed are only stepped while
+	// budget remains. Unfinished jobs rotate to the back, so the ones not reached go first next tick.
+	size_t TaskScheduler::RunQueue(std::deque<Step>& a_queue, size_t a_guaranteed)
+	{
+		const size_t count = a_queue.size();
+		size_t stepped = 0;
+
+		while (stepped < count && (stepped < a_guaranteed || !ShouldYield())) {
+			auto step = std::move(a_queue.front());
+			a_queue.pop_front();
+			stepped++;
+
+			if (step()) {
+				m_stats.completed.fetch_add(1, std::memory_order_relaxed);
+				m_stats.pending.fetch_sub(1, std::memory_order_release);
+			} else {
+				a_queue.push_back(std::move(step));
+			}
+		}
+
+		return stepped;
+	}
+
+	void TaskScheduler::Tick(std::chrono::microseconds a_budget)
+	{
+		const auto start = m_clock();
+		m_deadline = start + a_budget;
+
+		{
+			Locker locker(m_lock);
+			for (auto& [priority, step] : m_incoming) {
+				(priority == Priority::Critical ? m_critical : m_background).push_back(std::move(step));
+			}
+			m_incoming.clear();
+		}
+
+		size_t steps = RunQueue(m_critical, m_critical.size());
+		steps += RunQueue(m_background, 1);
+
+		m_stats.ticks.fetch_add(1, std::memory_order_relaxed);
+		m_stats.steps.fetch_add(static_cast<uint32_t>(steps), std::memory_order_relaxed);
+		m_stats.lastTickMs.store(std::chrono::duration<float, std::milli>(m_clock() - start).count(), std::memory_order_relaxed);
+	}
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
+
+namespace Modex
+{
+	// Cooperative per-frame scheduler for work that would stall the game if done in one go.
+	// Jobs are resumable steps: each is stepped at most once per Tick and returns true when it has
+	// finished. Long steps should loop internally and stop once ShouldYield() reports the frame
+	// budget is spent. Nothing in here touches the engine; Hooks drives Tick on the game thread.
+	class TaskScheduler
+	{
+	public:
+		enum class Priority : uint8_t
+		{
+			Critical = 0,  // Stepped every tick, even over budget. The user is waiting on these.
+			Background     // Stepped only while budget remains, but always at least one per tick.
+		};
+
+		using Clock = std::function<std::chrono::steady_clock::time_point()>;
+		using Step = std::function<bool()>;
+
+		struct TickStats
+		{
+			std::atomic<uint32_t> ticks{ 0 };
+			std::atomic<uint32_t> steps{ 0 };
+			std::atomic<uint32_t> completed{ 0 };
+			std::atomic<uint32_t> pending{ 0 };
+			std::atomic<float>    lastTickMs{ 0.0f };
+		};
+
+		static constexpr std::chrono::microseconds FRAME_BUDGET{ 2000 };
+
+		static inline TaskScheduler* GetSingleton()
+		{
+			static TaskScheduler singleton;
+			return std::addressof(singleton);
+		}
+
+		// A fake clock can be passed in to drive the scheduler without the game.
+		explicit TaskScheduler(Clock a_clock = nullptr);
+
+		void Submit(Priority a_priority, Step a_step);
+		void Tick(std::chrono::microseconds a_budget = FRAME_BUDGET);
+
+		bool ShouldYield() const;
+		bool HasPending() const { return m_stats.pending.load(std::memory_order_acquire) > 0; }
+		const TickStats& GetStats() const { return m_stats; }
+
+	private:
+		size_t RunQueue(std::deque<Step>& a_queue, size_t a_guaranteed);
+
+		Clock                                 m_clock;
+		std::chrono::steady_clock::time_point m_deadline{};
+
+		// Submissions land in m_incoming so steps may queue follow-up work while Tick is running.
+		ExclusiveLock                         m_lock;
+		std::vector<std::pair<Priority, Step>> m_incoming;
+		std::deque<Step>                      m_critical;
+		std::deque<Step>                      m_background;
+
+		TickStats                             m_stats;
+	};
+}
@@ -0,0 +1,125 @@
+#include "WorkerPool.h"
+
+namespace Modex
+{
+	WorkerPool::~WorkerPool()
+	{
+		// Joining from a static destructor can deadlock on the loader lock; Shutdown should have
+		// run from WM_DESTROY already. Anything still alive is left to process teardown.
+		for (auto& thread : m_threads) {
+			if (thread.joinable()) {
+				thread.detach();
+			}
+		}
+	}
+
+	// Stays well below the game's own job threads: a quarter of the hardware threads, 1 to 4.
+	void WorkerPool::Start()
+	{
+		const uint32_t hardware = std::thread::hardware_concurrency();
+		const uint32_t count = std::clamp(hardware / 4, 1u, 4u);
+
+		m_threads.reserve(count);
+		for (uint32_t i = 0; i < count; i++) {
+			m_threads.emplace_back([this]() { WorkerLoop(); });
+			::SetThreadPriority(m_threads.back().native_handle(), THREAD_PRIORITY_BELOW_NORMAL);
+		}
+
+		Debug("WorkerPool: Started {} worker threads ({} hardware threads).", count, hardware);
+	}
+
+	void WorkerPool::Enqueue(std::function<void()> a_job)
+	{
+		if (m_stopping.load(std::memory_order_acquire)) {
+			a_job();
+			return;
+		}
+
+		std::call_once(m_started, [this]() { Start(); });
+
+		{
+			Locker locker(m_lock);
+			m_jobs.push_back(std::move(a_job));
+			m_queued.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		m_wake.notify_one();
+	}
+
+	void WorkerPool::WorkerLoop()
+	{
+		while (true) {
+			std::function<void()> job;
+
+			{
+				std::unique_lock<ExclusiveLock> locker(m_lock);
+				m_wake.wait(locker, [this]() { return m_stopping.load(std::memory_order_acquire) || !m_jobs.empty(); });
+
+				if (m_jobs.empty())
+					return;
+
+				job = std::move(m_jobs.front());
+				m_jobs.pop_front();
+				m_queued.fetch_sub(1, std::memory_order_relaxed);
+			}
+
+			try {
+				job();
+			} catch (const std::exception& e) {
+				Error("WorkerPool: Job threw an exception: {}", e.what());
+			}
+		}
+	}
+
+	// Remaining jobs are finished before the threads exit, so pending saves still land.
+	void WorkerPool::Shutdown()
+	{
+		if (m_stopping.exchange(true, std::memory_order_acq_rel))
+			return;
+
+		m_wake.notify_all();
+
+		for (auto& thread : m_threads) {
+			if (thread.joinable()) {
+				thread.join();
+			}
+		}
+
+		m_threads.clear();
+
+		// Jobs that raced in while the workers were stopping run here instead of being dropped.
+		std::deque<std::function<void()>> leftover;
+		{
+			Locker locker(m_lock);
+			leftover.swap(m_jobs);
+			m_queued.store(0, std::memory_order_relaxed);
+		}
+
+		for (auto& job : leftover) {
+			job();
+		}
+	}
+
+	void WorkerPool::PostToMain(std::function<void()> a_func)
+	{
+		Locker locker(m_mainLock);
+		m_mainQueue.push_back(std::move(a_func));
+	}
+
+	void WorkerPool::DrainMainQueue()
+	{
+		std::vector<std::function<void()>> pending;
+
+		{
+			Locker locker(m_mainLock);
+			if (m_mainQueue.empty())
+				return;
+
+			pending.swap(m_mainQueue);
+		}
+
+		for (auto& func : pending) {
+			func();
+		}
+	}
+}
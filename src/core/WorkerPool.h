@@ -0,0 +1,109 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <thread>
+
+namespace Modex
+{
+	// Shared cancellation flag. Copies observe the same state; a default constructed token can
+	// never be cancelled.
+	class CancelToken
+	{
+	public:
+		static CancelToken Create()
+		{
+			CancelToken token;
+			token.m_flag = std::make_shared<std::atomic<bool>>(false);
+			return token;
+		}
+
+		void Cancel() const { if (m_flag) m_flag->store(true, std::memory_order_release); }
+		bool IsCancelled() const { return m_flag && m_flag->load(std::memory_order_acquire); }
+
+	private:
+		std::shared_ptr<std::atomic<bool>> m_flag;
+	};
+
+	// Small pool for CPU-heavy work that doesn't touch the engine or ImGui (sorting, indexing,
+	// JSON parsing, image decoding). Results that need the game or UI are handed back through
+	// PostToMain, which the Present hook drains once per frame.
+	class WorkerPool
+	{
+	public:
+		static inline WorkerPool* GetSingleton()
+		{
+			static WorkerPool singleton;
+			return std::addressof(singleton);
+		}
+
+		~WorkerPool();
+
+		// Threads are started on first use. After Shutdown, jobs run inline on the caller.
+		void Shutdown();
+
+		void PostToMain(std::function<void()> a_func);
+		void DrainMainQueue();
+
+		size_t GetThreadCount() const { return m_threads.size(); }
+		size_t GetQueuedCount() const { return m_queued.load(std::memory_order_relaxed); }
+
+		template <class F>
+		auto Submit(F&& a_func) -> std::future<std::invoke_result_t<std::decay_t<F>>>
+		{
+			using Result = std::invoke_result_t<std::decay_t<F>>;
+
+			auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(a_func));
+			auto future = task->get_future();
+			Enqueue([task]() { (*task)(); });
+			return future;
+		}
+
+		// Runs a_work(token) on a worker and a_done(result) on the main thread. Both are skipped
+		// once the token is cancelled, so a stale result never reaches the UI.
+		template <class W, class D>
+		void Dispatch(CancelToken a_token, W&& a_work, D&& a_done)
+		{
+			using Result = std::invoke_result_t<std::decay_t<W>, const CancelToken&>;
+
+			Enqueue([this, a_token, work = std::forward<W>(a_work), done = std::forward<D>(a_done)]() mutable {
+				if (a_token.IsCancelled())
+					return;
+
+				if constexpr (std::is_void_v<Result>) {
+					work(a_token);
+					PostToMain([a_token, done = std::move(done)]() mutable {
+						if (!a_token.IsCancelled()) done();
+					});
+				} else {
+					auto result = std::make_shared<Result>(work(a_token));
+					PostToMain([a_token, result, done = std::move(done)]() mutable {
+						if (!a_token.IsCancelled()) done(std::move(*result));
+					});
+				}
+			});
+		}
+
+	private:
+		WorkerPool() = default;
+
+		void Enqueue(std::function<void()> a_job);
+		void Start();
+		void WorkerLoop();
+
+		std::once_flag                     m_started;
+		std::vector<std::thread>           m_threads;
+		std::atomic<bool>                  m_stopping{ false };
+		std::atomic<size_t>                m_queued{ 0 };
+
+		ExclusiveLock                      m_lock;
+		std::condition_variable            m_wake;
+		std::deque<std::function<void()>>  m_jobs;
+
+		ExclusiveLock                      m_mainLock;
+		std::vector<std::function<void()>> m_mainQueue;
+	};
+}
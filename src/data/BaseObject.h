@@ -341,6 +341,25 @@ namespace Modex
 
 	};
 
+	// Load order slot of a plugin packed into one index: full plugins keep their compileIndex
+	// (0x00-0xFD), light plugins map to 0x100 + smallFileCompileIndex. Stable for the session,
+	// so it can key per-plugin lookups like the compiled blacklist.
+	inline constexpr uint16_t INVALID_FILE_INDEX = 0xFFFF;
+	inline constexpr size_t   FILE_INDEX_COUNT = 0x100 + 0x1000;
+
+	inline uint16_t PackFileIndex(const RE::TESFile* a_file)
+	{
+		if (a_file == nullptr || a_file->compileIndex == 0xFF) {
+			return INVALID_FILE_INDEX;
+		}
+
+		if (a_file->compileIndex == 0xFE) {
+			return static_cast<uint16_t>(0x100 + a_file->smallFileCompileIndex);
+		}
+
+		return a_file->compileIndex;
+	}
+
 	// Wrapper around TESForm pointer to provide safe accessors with default fallbacks.
 	// This is best-effort to avoid null pointer dereferences at runtime. \_(ツ)_/
 
@@ -398,6 +417,10 @@ namespace Modex
 		[[nodiscard]] RE::FormID WGetBaseFormID() const {
 			return m_form ? m_form->GetFormID() : 0;
 		}
+
+		[[nodiscard]] uint16_t WGetFileIndex() const {
+			return m_form ? PackFileIndex(m_form->GetFile(0)) : INVALID_FILE_INDEX;
+		}
 		
 		template<typename T>
 		[[nodiscard]] T* As() const {
@@ -417,6 +440,7 @@ namespace Modex
 		const std::string 		m_plugin;
 		const std::string 		m_formid;
 		const RE::FormID 		m_baseid;
+		const uint16_t			m_fileIndex;
 		const Ownership			m_owner;
 	public:
 		RE::FormID 			m_refID;
@@ -432,6 +456,7 @@ namespace Modex
 			, m_plugin{ m_formWrapper.WGetPluginName("[Missing Plugin]") }
 			, m_formid{ m_formWrapper. WGetFormID("[Missing FormID]") }
 			, m_baseid{ m_formWrapper.WGetBaseFormID() }
+			, m_fileIndex{ m_formWrapper.WGetFileIndex() }
 			, m_owner(a_owner)
 			, m_refID{ a_refID }
 			, m_tableID{ a_id }
@@ -447,6 +472,7 @@ namespace Modex
 			, m_plugin{ a_plugin }
 			, m_formid{ std::format("{:08X}", a_formID) }
 			, m_baseid{ a_formID }
+			, m_fileIndex{ INVALID_FILE_INDEX }
 			, m_owner(a_owner)
 			, m_refID{ a_refid }
 			, m_tableID{ a_id }
@@ -462,6 +488,7 @@ namespace Modex
 		inline RE::TESForm* 			GetTESForm() const { return m_formWrapper.Get(); }
 		inline RE::FormID 				GetBaseFormID() const { return m_baseid; }
 		inline RE::FormID 				GetRefID() const { return m_refID; }
+		inline uint16_t 				GetFileIndex() const { return m_fileIndex; }
 		inline ImGuiID 					GetTableID() const { return m_tableID; }
 		inline Ownership 				GetOwnership() const { return m_owner; }
 
@@ -1554,6 +1581,59 @@ namespace Modex
 
 			return "";
 		}
+
+		// Numeric form of a property for bulk readers such as the API batches, without the
+		// string round trip. Flags read as 0/1; nullopt when the property is not numeric or does
+		// not apply to this form (e.g. weapon damage on an armor).
+		std::optional<double> GetPropertyAsNumber(PropertyType a_property) const {
+			switch (a_property)
+			{
+				case PropertyType::kFormID:
+					return m_baseid;
+				case PropertyType::kReferenceID:
+					return m_refID == 0 ? std::nullopt : std::optional<double>(m_refID);
+				case PropertyType::kCarryWeight:
+					return GetWeight();
+				case PropertyType::kGoldValue:
+					return GetGoldValue();
+				case PropertyType::kPlayable:
+					return IsPlayable();
+				case PropertyType::kEnchanted:
+					return IsEnchanted();
+				case PropertyType::kArmorRating:
+					return IsArmor() ? std::optional<double>(GetArmorRating()) : std::nullopt;
+				case PropertyType::kWeaponDamage:
+					return IsWeapon() ? std::optional<double>(GetWeaponDamage()) : std::nullopt;
+				case PropertyType::kWeaponDamagePerSecond:
+					return IsWeapon() ? std::optional<double>(GetWeaponDamage() * GetWeaponSpeed()) : std::nullopt;
+				case PropertyType::kWeaponSpeed:
+					return IsWeapon() ? std::optional<double>(GetWeaponSpeed()) : std::nullopt;
+				case PropertyType::kWeaponCriticalDamage:
+					return IsWeapon() ? std::optional<double>(GetWeaponCritical()) : std::nullopt;
+				case PropertyType::kWeaponRange:
+					return IsWeapon() ? std::optional<double>(GetWeaponRange()) : std::nullopt;
+				case PropertyType::kWeaponStagger:
+					return IsWeapon() ? std::optional<double>(GetWeaponStagger()) : std::nullopt;
+				case PropertyType::kLevel:
+					return GetTESNPC() ? std::optional<double>(GetLevel()) : std::nullopt;
+				case PropertyType::kHealth:
+					return GetTESNPC() ? std::optional<double>(GetActorValue(RE::ActorValue::kHealth)) : std::nullopt;
+				case PropertyType::kMagicka:
+					return GetTESNPC() ? std::optional<double>(GetActorValue(RE::ActorValue::kMagicka)) : std::nullopt;
+				case PropertyType::kStamina:
+					return GetTESNPC() ? std::optional<double>(GetActorValue(RE::ActorValue::kStamina)) : std::nullopt;
+				case PropertyType::kUnique:
+					return IsUnique();
+				case PropertyType::kEssential:
+					return IsEssential();
+				case PropertyType::kDisabled:
+					return IsDisabled();
+				case PropertyType::kKitItemCount:
+					return m_quantity;
+				default:
+					return std::nullopt;
+			}
+		}
 	};
 
 	struct KitBase
@@ -1565,11 +1645,76 @@ namespace Modex
 		ImGuiID 		m_tableID = 0;
 	};
 
-	struct KitItem : KitBase
+	// Interned strings shared by every kit item. Entries are never removed, so an index stays
+	// valid for the session; index 0 is the empty string. Interning happens while kits are
+	// parsed on the worker pool, hence the lock.
+	class KitStringPool
+	{
+	public:
+		static inline KitStringPool* GetSingleton()
+		{
+			static KitStringPool singleton;
+			return std::addressof(singleton);
+		}
+
+		static uint32_t Intern(std::string_view a_string)
+		{
+			if (a_string.empty()) {
+				return 0;
+			}
+
+			auto* self = GetSingleton();
+			WriteLocker locker(self->m_lock);
+
+			if (auto it = self->m_lookup.find(a_string); it != self->m_lookup.end()) {
+				return it->second;
+			}
+
+			const auto index = static_cast<uint32_t>(self->m_strings.size());
+			const auto& stored = self->m_strings.emplace_back(a_string);
+			self->m_lookup.emplace(stored, index);
+			return index;
+		}
+
+		// Lookup without interning; returns 0 for strings no kit has used.
+		static uint32_t Find(std::string_view a_string)
+		{
+			auto* self = GetSingleton();
+			ReadLocker locker(self->m_lock);
+
+			auto it = self->m_lookup.find(a_string);
+			return it != self->m_lookup.end() ? it->second : 0;
+		}
+
+		static std::string_view Get(uint32_t a_index)
+		{
+			auto* self = GetSingleton();
+			ReadLocker locker(self->m_lock);
+			return a_index < self->m_strings.size() ? std::string_view(self->m_strings[a_index]) : std::string_view();
+		}
+
+	private:
+		KitStringPool() { m_strings.emplace_back(); }
+
+		SharedLock                                        m_lock;
+		std::deque<std::string>                           m_strings; // deque keeps views stable
+		std::unordered_map<std::string_view, uint32_t>    m_lookup;
+	};
+
+	// Flat, trivially copyable kit entry. The form is resolved to a FormID once per load; strings
+	// live in KitStringPool and are only touched for display, saving, or re-resolving by EditorID.
+	struct KitItem
 	{
-		int					m_amount;
-		bool				m_equipped;
-		BaseObject*			m_ref;
+		RE::FormID			m_formID = 0;
+		uint32_t			m_editorid = 0;
+		uint32_t			m_name = 0;
+		uint32_t			m_plugin = 0;
+		int32_t				m_amount = 1;
+		bool				m_equipped = false;
+
+		std::string_view GetEditorID() const { return KitStringPool::Get(m_editorid); }
+		std::string_view GetName() const { return KitStringPool::Get(m_name); }
+		std::string_view GetPlugin() const { return KitStringPool::Get(m_plugin); }
 
 		// Custom comparator for equality based on editorid
 		bool operator==(const KitItem& other) const
@@ -1577,28 +1722,46 @@ namespace Modex
 			return this->m_editorid == other.m_editorid;
 		}
 
+		// Re-resolves by EditorID only when the stored FormID no longer points at a form.
+		RE::TESForm* GetForm() const {
+			if (m_formID != 0) {
+				if (auto form = RE::TESForm::LookupByID(m_formID); form != nullptr) {
+					return form;
+				}
+			}
+
+			return m_editorid != 0 ? RE::TESForm::LookupByEditorID(GetEditorID()) : nullptr;
+		}
+
+		void Resolve() {
+			auto form = GetForm();
+			m_formID = form ? form->GetFormID() : 0;
+		}
+
 		// Conversion operator:  KitItem -> BaseObject
 		operator BaseObject() const {
-			const auto form = RE::TESForm::LookupByEditorID(m_editorid);
+			const auto form = GetForm();
 
 			if (form == nullptr) {
-				return BaseObject(m_name, m_editorid, m_plugin, Ownership::None);
+				return BaseObject(std::string(GetName()), std::string(GetEditorID()), std::string(GetPlugin()), Ownership::None);
 			} else {
 				return BaseObject(form, Ownership::None);
 			}
 		}
 
 		operator std::unique_ptr<BaseObject>() const {
-			const auto form = RE::TESForm::LookupByEditorID(m_editorid);
+			const auto form = GetForm();
 
 			if (form == nullptr) {
-				return std::make_unique<BaseObject>(m_name, m_editorid, m_plugin, Ownership::None);
+				return std::make_unique<BaseObject>(std::string(GetName()), std::string(GetEditorID()), std::string(GetPlugin()), Ownership::None);
 			} else {
 				return std::make_unique<BaseObject>(form, Ownership::None);
 			}
 		}
 	};
 
+	static_assert(std::is_trivially_copyable_v<KitItem>);
+
 	struct KitPerk : KitBase
 	{
 		int rank;
@@ -1639,7 +1802,7 @@ namespace Modex
 	{
 	public:
 		std::string m_desc;
-		std::vector<std::shared_ptr<KitItem>> m_items;
+		std::vector<KitItem> m_items;
 
 		// runtime
 		ImGuiID m_tableID = 0;
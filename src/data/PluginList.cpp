@@ -219,18 +219,17 @@ namespace Modex
 	std::vector<std::string> Data::GetFilteredListOfPluginNames(Ownership a_owner, PluginSort a_sort)
 	{
 		const auto& masterlist = GetModulePluginListSorted(a_owner, a_sort);
-		const auto& blacklist = BlacklistConfig::Get();
+		const auto* blacklist = BlacklistConfig::GetSingleton();
 
 		std::vector<std::string> pluginList;
+		pluginList.reserve(masterlist.size());
 
 		for (const auto& plugin : masterlist) {
-			const std::string name = plugin->GetFilename().data();
-
-			if (blacklist.contains(plugin)) {
+			if (blacklist->Has(plugin)) {
 				continue;
 			}
 
-			pluginList.push_back(name);
+			pluginList.emplace_back(plugin->GetFilename());
 		}
 
 		return pluginList;
@@ -1,4 +1,7 @@
 #include "FontManager.h"
+
+#include <fstream>
+
 #include "config/UserConfig.h"
 #include "external/icons/IconsLucide.h"
 
@@ -13,6 +16,89 @@ namespace Modex
 		}
 	}
 
+	// Re-reads only when the file's size or write time changed. The pointer is valid until the
+	// next call, which may evict it.
+	const FontBlob* FontManager::GetFontBlob(const std::filesystem::path& a_path)
+	{
+		std::error_code ec;
+		const auto mtime = std::filesystem::last_write_time(a_path, ec);
+		const auto size = ec ? 0 : std::filesystem::file_size(a_path, ec);
+
+		if (ec) {
+			Error("Failed to stat font file: {}", a_path.string());
+			return nullptr;
+		}
+
+		const auto key = a_path.lexically_normal().string();
+		auto& blob = m_blobs[key];
+
+		if (!blob.data.empty() && blob.mtime == mtime && blob.size == size) {
+			blob.lastUse = ++m_blobUse;
+			return &blob;
+		}
+
+		blob.mtime = mtime;
+		blob.size = size;
+		blob.data.resize(static_cast<size_t>(size));
+		blob.lastUse = ++m_blobUse;
+
+		std::ifstream file(a_path, std::ios::binary);
+		if (!file.is_open() || !file.read(blob.data.data(), static_cast<std::streamsize>(size))) {
+			Error("Failed to read font file: {}", a_path.string());
+			m_blobs.erase(key);
+			return nullptr;
+		}
+
+		Trace("Cached font file '{}' ({} bytes)", a_path.filename().string(), size);
+
+		TrimFontCache(key);
+		return &blob;
+	}
+
+	// Evicts least recently used blobs, other than a_keep, until under budget.
+	void FontManager::TrimFontCache(const std::string& a_keep)
+	{
+		std::uintmax_t total = 0;
+		for (const auto& [key, blob] : m_blobs) {
+			total += blob.size;
+		}
+
+		while (total > MAX_FONT_CACHE_BYTES) {
+			auto victim = m_blobs.end();
+			for (auto it = m_blobs.begin(); it != m_blobs.end(); ++it) {
+				if (it->first != a_keep && (victim == m_blobs.end() || it->second.lastUse < victim->second.lastUse)) {
+					victim = it;
+				}
+			}
+
+			if (victim == m_blobs.end()) {
+				break;
+			}
+
+			total -= victim->second.size;
+			m_blobs.erase(victim);
+		}
+	}
+
+	// AddFontFromFileTTF equivalent that builds from the cached bytes instead of reading the
+	// file again. With FontDataOwnedByAtlas = false, ImFontAtlas::AddFont (1.92) duplicates the
+	// data into an atlas-owned buffer, so the cache can evict or re-read the blob at any time.
+	ImFont* FontManager::AddFont(const std::filesystem::path& a_path, ImFontConfig& a_config)
+	{
+		const FontBlob* blob = GetFontBlob(a_path);
+		if (!blob || blob->data.empty()) {
+			return nullptr;
+		}
+
+		a_config.FontDataOwnedByAtlas = false;
+		if (a_config.Name[0] == '\0') {
+			ImFormatString(a_config.Name, IM_ARRAYSIZE(a_config.Name), "%s", a_path.filename().string().c_str());
+		}
+
+		auto& io = ImGui::GetIO();
+		return io.Fonts->AddFontFromMemoryTTF(const_cast<char*>(blob->data.data()), static_cast<int>(blob->data.size()), 0.0f, &a_config);
+	}
+
 	// Compile list of recognized custom fonts from interface directory.
 	void FontManager::BuildLocalFontLibrary()
 	{
@@ -78,8 +164,7 @@ namespace Modex
 
 		auto& user_font = UserConfig::Get().globalFont;
 		for (const auto& font : m_library) {
-			if (font.name == user_font) {
-				SetFont(font.filepath);
+			if (font.name == user_font && SetFont(font.filepath)) {
 				return;
 			}	
 		}
@@ -90,29 +175,36 @@ namespace Modex
 	
 	void FontManager::MergeIcons()
 	{
-		auto& io = ImGui::GetIO();
-
 		ImFontConfig icon_config;
 		icon_config.MergeMode = true;
 		icon_config.GlyphOffset.y = 3.0f;
 		icon_config.DstFont = m_base.font;
 
-		io.Fonts->AddFontFromFileTTF(MODEX_ICON_FILE.string().c_str(), 0.0f, &icon_config);
+		AddFont(MODEX_ICON_FILE, icon_config);
 	}
 
-	void FontManager::SetFont(const std::filesystem::path& a_path)
+	// Base and bold are built from the same cached bytes, so the file is read at most once.
+	bool FontManager::SetFont(const std::filesystem::path& a_path)
 	{
-		auto &io = ImGui::GetIO();
 		auto _base = std::move(m_base);
 		auto _bold = std::move(m_bold);
 
 		m_base = FontData(false);
-		m_base.font = io.Fonts->AddFontFromFileTTF(a_path.string().c_str(), 0.0f, &m_base.config);
-		m_base.owner = m_base.font->OwnerAtlas;
+		m_base.font = AddFont(a_path, m_base.config);
+		m_base.owner = m_base.font ? m_base.font->OwnerAtlas : nullptr;
 
 		m_bold = FontData(true);
-		m_bold.font = io.Fonts->AddFontFromFileTTF(a_path.string().c_str(), 0.0f, &m_bold.config);
-		m_bold.owner = m_bold.font->OwnerAtlas;
+		m_bold.font = AddFont(a_path, m_bold.config);
+		m_bold.owner = m_bold.font ? m_bold.font->OwnerAtlas : nullptr;
+
+		if (!m_base.font || !m_bold.font) {
+			Error("Failed to load font '{}'. Keeping the previous font.", a_path.string());
+			m_base.Cleanup();
+			m_bold.Cleanup();
+			m_base = std::move(_base);
+			m_bold = std::move(_bold);
+			return false;
+		}
 
 		MergeIcons();
 
@@ -120,5 +212,6 @@ namespace Modex
 		_bold.Cleanup();
 
 		Info("Set font to: {}", a_path.string());
+		return true;
 	}
 }
@@ -30,6 +30,16 @@ namespace Modex
 		ImGui::TextWrapped("%s", PREVIEW_TEXT.c_str());
 	}
 
+	// Raw bytes of a font file, kept so rebuilding a font skips the disk read. The atlas takes
+	// its own copy when a font is added, so fonts never reference these bytes.
+	struct FontBlob
+	{
+		std::filesystem::file_time_type	mtime{};
+		std::uintmax_t			size = 0;
+		std::vector<char>		data;
+		uint64_t			lastUse = 0;
+	};
+
 	struct FontData
 	{
 		ImFont 			*font = nullptr;
@@ -69,11 +79,22 @@ namespace Modex
 	class FontManager
 	{
 	private:
+		// Blobs are kept up to this many bytes so switching back to a recent font (or reloading
+		// the current one) skips the disk read.
+		static constexpr std::uintmax_t MAX_FONT_CACHE_BYTES = 64ull * 1024 * 1024;
+
 		std::vector<FontInfo>	m_library;
 		FontData 		m_base{ false };
 		FontData		m_bold{ true };
 		static inline bool 	dirty;
 
+		std::unordered_map<std::string, FontBlob> m_blobs;
+		uint64_t 		m_blobUse = 0;
+
+		const FontBlob* GetFontBlob(const std::filesystem::path& a_path);
+		ImFont* AddFont(const std::filesystem::path& a_path, ImFontConfig& a_config);
+		void TrimFontCache(const std::string& a_keep);
+
 	public:
 		FontManager() = default;
 		~FontManager() = default;
@@ -90,7 +111,7 @@ namespace Modex
 		void Cleanup();
 		void MergeIcons();
 		void SetDefault();
-		void SetFont(const std::filesystem::path& a_path);
+		bool SetFont(const std::filesystem::path& a_path);
 
 		void BuildLocalFontLibrary();
 
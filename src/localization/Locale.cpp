@@ -1,112 +1,237 @@
 #include "localization/Locale.h"
 
+#include <bit>
+
 namespace Modex
 {
-    static constexpr size_t hash_string(const char* str, size_t value = 5381) noexcept
+	bool Locale::Load(bool a_create)
 	{
-		return *str ? hash_string(str + 1, (value * 33) ^ static_cast<size_t>(*str)) : value;
+		ASSERT_MSG(a_create, "Localization does not create files!");
+
+		if (m_initialized == false) {
+			BuildLocaleList();
+			ValidateLanguages();
+		}
+
+		ASSERT_MSG(!ConfigManager::Load(a_create), "Failed to load localization file!");
+
+		BuildTable();
+		return true;
 	}
 
-	template<size_t N>
-	struct CompileTimeString
+	const Locale::Slot* Locale::Find(uint64_t a_hash) const
 	{
-		constexpr CompileTimeString(const char(&str)[N]) : hash(hash_string(str))
-		{
-			for (size_t i = 0; i < N; ++i) {
-				data[i] = str[i];
-			}
+		if (m_table.empty()) {
+			return nullptr;
 		}
 
-		char data[N];
-		size_t hash;
-		static constexpr size_t size = N;
-	};
+		const size_t mask = m_table.size() - 1;
+		for (size_t i = a_hash & mask;; i = (i + 1) & mask) {
+			const Slot& slot = m_table[i];
+			if (slot.hash == a_hash) {
+				return &slot;
+			}
 
-	bool Locale::Load(bool a_create)
+			if (slot.hash == 0) {
+				return nullptr;
+			}
+		}
+	}
+
+	// Table is sized at load so it never fills; there is always an empty slot to stop a probe.
+	Locale::Slot& Locale::Insert(uint64_t a_hash)
 	{
-		ASSERT_MSG(a_create, "Localization does not create files!");
+		const size_t mask = m_table.size() - 1;
+		for (size_t i = a_hash & mask;; i = (i + 1) & mask) {
+			Slot& slot = m_table[i];
+			if (slot.hash == a_hash || slot.hash == 0) {
+				slot.hash = a_hash;
+				return slot;
+			}
+		}
+	}
 
-		m_hash.clear();
+	// Two hashes per entry at most (the key and a tooltip's base key), kept under half load.
+	void Locale::BuildTable()
+	{
+		m_table.clear();
+		m_values.clear();
 
-		if (m_initialized == false) {
-			BuildLocaleList();
+		if (!m_data.is_object() || m_data.empty()) {
+			return;
 		}
 
-		ASSERT_MSG(!ConfigManager::Load(a_create), "Failed to load localization file!");
+		m_table.resize(std::bit_ceil(std::max<size_t>(16, m_data.size() * 4)));
+		m_values.reserve(m_data.size());
+
+		std::unordered_map<uint64_t, std::string> seen;
+		seen.reserve(m_data.size() * 2);
+
+		const auto claim = [&seen](uint64_t a_hash, std::string_view a_key) {
+			const auto [it, inserted] = seen.try_emplace(a_hash, a_key);
+			ASSERT_MSG(!inserted && it->second != a_key, "Locale key hash collision between '{}' and '{}'!", it->second, a_key);
+		};
 
-		if (!m_data.empty()) {        
-			for (auto& [key, value] : m_data.items()) {
-				size_t key_hash = hash_string(key.c_str());
-				m_hash[key_hash] = value;
+		for (const auto& [key, value] : m_data.items()) {
+			if (!value.is_string()) {
+				Warn("Locale: Skipping non-string value for key '{}' in '{}'.", key, m_file_path.filename().string());
+				continue;
+			}
+
+			const uint64_t hash = HashLocaleKey(key);
+			claim(hash, key);
+
+			Slot& slot = Insert(hash);
+			slot.value = static_cast<int32_t>(m_values.size());
+			m_values.push_back(value.get<std::string>());
+
+			// Tooltips are indexed under their base key as well, so GetTooltip never concatenates.
+			const std::string_view view(key);
+			if (view.size() > TOOLTIP_SUFFIX.size() && view.ends_with(TOOLTIP_SUFFIX)) {
+				const auto base = view.substr(0, view.size() - TOOLTIP_SUFFIX.size());
+				const uint64_t base_hash = HashLocaleKey(base);
+				claim(base_hash, base);
+
+				Insert(base_hash).tooltip = slot.value;
 			}
 		}
 
-		return true;
+		Trace("Locale: Indexed {} keys into {} slots.", m_values.size(), m_table.size());
 	}
 
-	const char* Locale::GetTranslation(const char* fallback_text) const
+	// Every language file should carry the reference language's keys. Missing keys only fall back
+	// to the raw key at runtime, so they are reported as errors up front instead.
+	void Locale::ValidateLanguages() const
 	{
-		size_t text_hash = hash_string(fallback_text);
+		const auto read = [](const std::filesystem::path& a_path) -> nlohmann::json {
+			std::ifstream file(a_path);
+			if (!file.is_open()) {
+				return {};
+			}
 
-		auto it = m_hash.find(text_hash);
-		if (it != m_hash.end()) {
-			return it->second.c_str();
+			return nlohmann::json::parse(file, nullptr, false);
+		};
+
+		const auto reference = read(LOCALE_JSON_DIR / (std::string(REFERENCE_LANGUAGE) + ".json"));
+		if (!reference.is_object()) {
+			Warn("Locale: Reference language '{}' not found, skipping key validation.", REFERENCE_LANGUAGE);
+			return;
 		}
 
-		return fallback_text;
+		for (const auto& language : m_languages) {
+			if (language == REFERENCE_LANGUAGE) {
+				continue;
+			}
+
+			const auto data = read(LOCALE_JSON_DIR / (language + ".json"));
+			if (!data.is_object()) {
+				Error("Locale: Language file '{}' is not a valid JSON object.", language);
+				continue;
+			}
+
+			std::vector<std::string> missing;
+			for (const auto& [key, value] : reference.items()) {
+				if (!data.contains(key)) {
+					missing.push_back(key);
+				}
+			}
+
+			if (missing.empty()) {
+				continue;
+			}
+
+			Error("Locale: Language '{}' is missing {} of {} keys:", language, missing.size(), reference.size());
+			for (const auto& key : missing) {
+				Error(" - {}", key);
+			}
+		}
 	}
 
-	bool Locale::HasEntry(const char* a_localeString) const
+	const char* Locale::GetTranslation(LocaleKey a_key) const
 	{
-		size_t tooltip_hash = hash_string(a_localeString);
-
-		auto it = m_hash.find(tooltip_hash);
-		if (it != m_hash.end()) {
-			return true;
+		if (const Slot* slot = Find(a_key.hash); slot && slot->value >= 0) {
+			return m_values[slot->value].c_str();
 		}
 
-		return false;
+		return a_key.text;
 	}
 
-	const char* Locale::GetTooltip(const char* a_localeString) const
+	bool Locale::HasEntry(LocaleKey a_key) const
 	{
-		std::string tooltip_key = std::string(a_localeString) + std::string("_TOOLTIP");
-		size_t tooltip_hash = hash_string(tooltip_key.c_str());
+		const Slot* slot = Find(a_key.hash);
+		return slot && slot->value >= 0;
+	}
 
-		auto it = m_hash.find(tooltip_hash);
-		if (it != m_hash.end()) {
-			return it->second.c_str();
+	const char* Locale::GetTooltip(LocaleKey a_key) const
+	{
+		if (const Slot* slot = Find(a_key.hash); slot && slot->tooltip >= 0) {
+			return m_values[slot->tooltip].c_str();
 		}
 
 		return "";
 	}
 
-	std::string Locale::TruncateText(const std::string& a_text, float a_width)
+	size_t Locale::TruncateKeyHash::operator()(const TruncateView& a_key) const noexcept
 	{
+		size_t seed = std::hash<std::string_view>{}(a_key.text);
+		seed ^= std::hash<const void*>{}(a_key.font) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+		seed ^= std::hash<float>{}(a_key.fontSize) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+		seed ^= std::hash<float>{}(a_key.width) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+		return seed;
+	}
+
+	// Walks the text one UTF-8 codepoint at a time, summing advances from the baked font of
+	// the current font size (the same table ImGui::CalcTextSize reads). The cut point is the
+	// last codepoint boundary whose running width still leaves room for the ellipsis, so
+	// multi-byte names are never split mid-sequence. The returned reference points into the
+	// cache and is valid until the end of the current frame.
+	const std::string& Locale::TruncateText(const std::string& a_text, float a_width)
+	{
+		ImFont* font = ImGui::GetFont();
+		const float font_size = ImGui::GetFontSize();
+
+		if (const int frame = ImGui::GetFrameCount(); frame != m_truncateFrame) {
+			m_truncateFrame = frame;
+
+			if (m_truncateCache.size() >= MAX_TRUNCATE_CACHE) {
+				m_truncateCache.clear();
+			}
+		}
+
+		const TruncateView key{ a_text, font, font_size, a_width };
+		if (auto it = m_truncateCache.find(key); it != m_truncateCache.end()) {
+			return it->second;
+		}
+
+		std::string result = a_text;
 		const float textWidth = ImGui::CalcTextSize(a_text.c_str()).x;
 
 		if (textWidth > a_width) {
+			ImFontBaked* baked = ImGui::GetFontBaked();
 			const float ellipsisWidth = ImGui::CalcTextSize("...").x;
-
-			std::string result = "";
+			const char* text_begin = a_text.c_str();
+			const char* text_end = text_begin + a_text.size();
+			const char* cut = text_begin;
 			float resultWidth = 0.0f;
 
-			for (const auto& c : a_text) {
-				const float charWidth = ImGui::CalcTextSize(std::string(1, c).c_str()).x;
+			while (cut < text_end) {
+				unsigned int c = 0;
+				const int len = ImTextCharFromUtf8(&c, cut, text_end);
+				const float charWidth = baked->GetCharAdvance(static_cast<ImWchar>(c));
 
 				if (resultWidth + charWidth + ellipsisWidth > a_width) {
-					result += "...";
 					break;
 				}
 
-				result += c;
 				resultWidth += charWidth;
+				cut += len > 0 ? len : 1;
 			}
 
-			return result;
+			result.assign(text_begin, cut);
+			result += "...";
 		}
 
-		return a_text;
+		return m_truncateCache.emplace(TruncateKey{ a_text, font, font_size, a_width }, std::move(result)).first->second;
 	}
 
 	std::filesystem::path Locale::GetFilepath(const std::string& a_stem)
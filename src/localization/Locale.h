@@ -7,11 +7,97 @@ namespace Modex
 	static inline const std::filesystem::path LOCALE_JSON_DIR = 
 	std::filesystem::path("data") / "interface" / "modex" / "language";
 
+	// 64-bit FNV-1a over a locale key. Literal keys go through the consteval LocaleKey constructor,
+	// so the hot Translate() path for string literals does no hashing at runtime.
+	constexpr uint64_t HashLocaleKey(std::string_view a_key) noexcept
+	{
+		uint64_t hash = 14695981039346656037ull;
+		for (const char c : a_key) {
+			hash ^= static_cast<uint8_t>(c);
+			hash *= 1099511628211ull;
+		}
+		return hash == 0 ? 1 : hash;
+	}
+
+	struct LocaleKey
+	{
+		uint64_t    hash;
+		const char* text;
+
+		template <size_t N>
+		consteval LocaleKey(const char (&a_text)[N]) :
+			hash(HashLocaleKey(std::string_view(a_text, N - 1))), text(a_text)
+		{}
+
+		// Runtime keys (kit names, module ids, etc.) still hash on the call.
+		template <class T>
+			requires std::convertible_to<T, const char*>
+		LocaleKey(const T& a_text) :
+			hash(HashLocaleKey(a_text ? std::string_view(a_text) : std::string_view())), text(a_text ? a_text : "")
+		{}
+	};
+
 	class Locale : public ConfigManager
 	{
 	private:
-		std::unordered_map<size_t, std::string> m_hash;
+		// Open-addressing table keyed by LocaleKey hash. Each slot carries the key's value and,
+		// when a "<KEY>_TOOLTIP" entry exists, the tooltip value too, so GetTooltip is one probe.
+		struct Slot
+		{
+			uint64_t hash = 0;
+			int32_t  value = -1;
+			int32_t  tooltip = -1;
+		};
+
+		static constexpr std::string_view TOOLTIP_SUFFIX = "_TOOLTIP";
+		static constexpr std::string_view REFERENCE_LANGUAGE = "english";
+
+		// Truncation results keyed by text, available width, and the font it was measured with.
+		// Lookups go through TruncateView so a cache hit never allocates.
+		struct TruncateView
+		{
+			std::string_view text;
+			const ImFont*    font;
+			float            fontSize;
+			float            width;
+
+			bool operator==(const TruncateView&) const = default;
+		};
+
+		struct TruncateKey
+		{
+			std::string      text;
+			const ImFont*    font;
+			float            fontSize;
+			float            width;
+
+			TruncateView View() const { return { text, font, fontSize, width }; }
+		};
+
+		struct TruncateKeyHash
+		{
+			using is_transparent = void;
+			size_t operator()(const TruncateView& a_key) const noexcept;
+			size_t operator()(const TruncateKey& a_key) const noexcept { return (*this)(a_key.View()); }
+		};
+
+		struct TruncateKeyEqual
+		{
+			using is_transparent = void;
+			bool operator()(const TruncateKey& a_lhs, const TruncateKey& a_rhs) const noexcept { return a_lhs.View() == a_rhs.View(); }
+			bool operator()(const TruncateView& a_lhs, const TruncateKey& a_rhs) const noexcept { return a_lhs == a_rhs.View(); }
+			bool operator()(const TruncateKey& a_lhs, const TruncateView& a_rhs) const noexcept { return a_lhs.View() == a_rhs; }
+		};
+
+		// Soft cap: a full cache is only cleared on the first call of a new frame, so references
+		// handed out by TruncateText stay valid for the rest of the frame they were returned in.
+		static constexpr size_t MAX_TRUNCATE_CACHE = 4096;
+
+		std::vector<Slot>        m_table;
+		std::vector<std::string> m_values;
 		std::vector<std::string> m_languages;
+		std::unordered_map<TruncateKey, std::string, TruncateKeyHash, TruncateKeyEqual> m_truncateCache;
+		int                      m_truncateFrame = -1;
 
 	public:
 		static inline Locale* GetSingleton()
@@ -26,16 +112,22 @@ namespace Modex
 
 		std::vector<std::string> GetLanguages() noexcept { return m_languages; }
 		std::filesystem::path GetFilepath(const std::string& a_stem);
-		const char* GetTranslation(const char* fallback_text) const;
-		const char* GetTooltip(const char* a_localeString) const;
-		bool HasEntry(const char* a_localeString) const;
-		bool HasTranslation(const char* a_localeString) const;
+		const char* GetTranslation(LocaleKey a_key) const;
+		const char* GetTooltip(LocaleKey a_key) const;
+		bool HasEntry(LocaleKey a_key) const;
+
+		const std::string& TruncateText(const std::string& a_text, float a_maxLength);
+
+	private:
+		const Slot* Find(uint64_t a_hash) const;
+		Slot&       Insert(uint64_t a_hash);
 
-		std::string TruncateText(const std::string& a_text, float a_maxLength);
+		void BuildTable();
+		void ValidateLanguages() const;
     };
 
     #define TRUNCATE(text, maxLength) Locale::GetSingleton()->TruncateText(text, maxLength)
-	#define Translate(text) Locale::GetSingleton()->GetTranslation(text)
+	#define Translate(text) Locale::GetSingleton()->GetTranslation(Modex::LocaleKey(text))
     #define TranslateFormat(text, suffix) (std::string(Translate(text)) + suffix).c_str()
     #define TranslateIcon(icon, text) ((std::string(icon) + Translate(text)).c_str())
     #define TranslateIconFormat(icon, text, suffix) ((std::string(icon) + Translate(text) + suffix).c_str())
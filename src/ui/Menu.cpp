@@ -128,7 +128,7 @@ namespace Modex
 		}
 		
 		// Push style for Modex Menu window
-		ImGui::PushStyleColor(ImGuiCol_WindowBg, ThemeConfig::GetColor("WINDOW_BACKGROUND", m_alpha));
+		ImGui::PushStyleColor(ImGuiCol_WindowBg, ThemeConfig::GetColor(ThemeColor::WindowBackground, m_alpha));
 
 		if (!m_apiMode && config.fullscreen) {
 			ImGui::SetNextWindowPos(ImVec2(0.f, 0.f));
@@ -172,7 +172,7 @@ namespace Modex
 		ImGui::PushStyleVar(ImGuiStyleVar_WindowBorderSize, 0.0f);
 		ImGui::PushStyleVar(ImGuiStyleVar_WindowRounding, 0.0f);
 		ImGui::PushStyleColor(ImGuiCol_Border, ImVec4(0.0f, 0.0f, 0.0f, 0.0f));
-		ImGui::PushStyleColor(ImGuiCol_WindowBg, ThemeConfig::GetColor("SCREEN_BACKGROUND", m_alpha));
+		ImGui::PushStyleColor(ImGuiCol_WindowBg, ThemeConfig::GetColor(ThemeColor::ScreenBackground, m_alpha));
 		ImGui::Begin("##Modex::Background", nullptr, BACKGROUND_FLAGS);
 
 		// Render a splash logo if theme contains a valid path.
@@ -217,7 +217,8 @@ namespace Modex
 				// This is ridiculous, but is required due to Skyrim Upscaler Plugin. Typically, I could just
 				// create a clip rect, or just hide the image behind the child window outside the sidebar. However,
 				// when using Skyrim Upscaler Plugin. The texture clips over the bounds for some reason...
-				ImTextureID texture = reinterpret_cast<ImTextureID>(GraphicManager::image_library["new_logo"].texture);
+				const auto& logo = GraphicManager::image_library["new_logo"];
+				ImTextureID texture = reinterpret_cast<ImTextureID>(logo.texture);
 
 				// Using a fixed image width and height, since the sidebar is also a fixed width and height.
 				constexpr float image_height = 54.0f;
@@ -235,7 +236,7 @@ namespace Modex
 				ImGui::PushStyleColor(ImGuiCol_Border, ImVec4(0.f, 0.f, 0.f, 0.f));
 				ImGui::PushStyleColor(ImGuiCol_BorderShadow, ImVec4(0.f, 0.f, 0.f, 0.f));
 
-				if (ImGui::ImageButton("Modex::Sidebar::Expand", texture, ImVec2(image_width * (sidebar_w / image_width) - 15.0f, image_height), ImVec2(0, 0), ImVec2(uv_x, 1.0f))) {
+				if (ImGui::ImageButton("Modex::Sidebar::Expand", texture, ImVec2(image_width * (sidebar_w / image_width) - 15.0f, image_height), logo.UV(0.0f, 0.0f), logo.UV(uv_x, 1.0f))) {
 					this->expand_sidebar = !this->expand_sidebar;
 					UserData::Set<bool>("Menu::Sidebar", this->expand_sidebar);
 				}
@@ -7,6 +7,7 @@
 #include "imgui_internal.h"
 #include "localization/Locale.h"
 #include "config/ThemeConfig.h"
+#include "config/EquipmentConfig.h"
 #include "ui/components/UINotification.h"
 #include "external/framework/DescriptionFrameworkImpl.h"
 
@@ -171,6 +172,17 @@ namespace
 		inlineText(a_object, PropertyType::kFormID);
 		inlineText(a_object, PropertyType::kPlugin);
 		inlineText(a_object, PropertyType::kEditorID);
+
+		// Kit usage badge, answered from the cross-kit index.
+		if (const auto count = EquipmentConfig::GetKitCountWithForm(a_object->GetBaseFormID()); count > 0) {
+			std::string tooltip = Translate("KIT_USAGE_TOOLTIP");
+			for (const auto& key : EquipmentConfig::FindKitsWithForm(a_object->GetBaseFormID())) {
+				tooltip += "\n- " + key;
+			}
+
+			const std::string label = std::string(ICON_LC_PACKAGE " ") + Translate("KIT_USAGE");
+			inlineTextEx(label.c_str(), std::to_string(count).c_str(), tooltip.c_str());
+		}
 	}
 
 	inline void drawLoadOrder(const std::unique_ptr<BaseObject>& a_object)
@@ -652,7 +664,7 @@ namespace
 
 		ImGui::PushStyleVar(ImGuiStyleVar_SelectableTextAlign, ImVec2(0.f, 0.5f));
 		if (ImGui::BeginChild("##Modex::Favorite::List", ImVec2(0.f, 0.f), 0, 0)) {
-			const auto& favorites = UserData::GetFavoritesAsVector();
+			const auto& favorites = UserData::GetFavoriteItems();
 			auto temp = std::vector<std::unique_ptr<BaseObject>>();
 
 			// NOTE: Exterior cells that lack a FULL record likely aren't preloaded, and won't be
@@ -704,10 +716,10 @@ namespace
 		{ // Name Bar
 			auto name = TRUNCATE(a_item->GetName(), max_width * 0.80f);
 			const auto color = ImGui::GetStyleColorVec4(ImGuiCol_Border);
-			const auto text_color = a_item->IsEnchanted() ? ThemeConfig::GetColor("TEXT_ENCHANTED") : ThemeConfig::GetColor("TEXT");
+			const auto text_color = a_item->IsEnchanted() ? ThemeConfig::GetColor(ThemeColor::TextEnchanted) : ThemeConfig::GetColor(ThemeColor::Text);
 
-			draw_list->AddRectFilled(cursor, ImVec2(cursor.x + max_width, cursor.y + font_size * 2.5f), ThemeConfig::GetColorU32("BG", alpha));
-			draw_list->AddRect(cursor, ImVec2(cursor.x + max_width, cursor.y + font_size * 2.5f), ThemeConfig::GetColorU32("BORDER", alpha));
+			draw_list->AddRectFilled(cursor, ImVec2(cursor.x + max_width, cursor.y + font_size * 2.5f), ThemeConfig::GetColorU32(ThemeColor::Bg, alpha));
+			draw_list->AddRect(cursor, ImVec2(cursor.x + max_width, cursor.y + font_size * 2.5f), ThemeConfig::GetColorU32(ThemeColor::Border, alpha));
 
 			ImGui::NewLine();
 			ImGui::SetCursorPosX(UICustom::GetCenterTextPosX(name.data()));
@@ -724,7 +736,7 @@ namespace
 		// Tooltips don't play well with autosizing child windows.
 		if (!a_tooltip) ImGui::BeginChild("##ItemPreview::ScrollArea", ImVec2(0, 0), false, false);
 		{
-			ImGui::PushStyleColor(ImGuiCol_Separator, ThemeConfig::GetColorU32("PRIMARY"));
+			ImGui::PushStyleColor(ImGuiCol_Separator, ThemeConfig::GetColorU32(ThemeColor::Primary));
 			drawBasePreview(a_item);
 
 			if (a_item->GetTESNPC()) {
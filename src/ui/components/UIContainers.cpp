@@ -56,9 +56,9 @@ namespace Modex
 
 			UICustom::SubCategoryHeader(action_header);
 			
-			ImGui::PushStyleColor(ImGuiCol_Button, ThemeConfig::GetColor("SECONDARY"));
-			ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ThemeConfig::GetHover("SECONDARY"));
-			ImGui::PushStyleColor(ImGuiCol_ButtonActive, ThemeConfig::GetActive("SECONDARY"));
+			ImGui::PushStyleColor(ImGuiCol_Button, ThemeConfig::GetColor(ThemeColor::Secondary));
+			ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ThemeConfig::GetHover(ThemeColor::Secondary));
+			ImGui::PushStyleColor(ImGuiCol_ButtonActive, ThemeConfig::GetActive(ThemeColor::Secondary));
 			if (UICustom::ActionButton("CONTAINER_VIEW_TARGET", ImVec2(max_width, button_height), !is_player_target && !Commands::IsGameMenuOpen() && a_view->IsValidTargetReference())) {
 				Commands::OpenActorInventory(a_view->GetTableTargetRef());
 			}
@@ -90,9 +90,9 @@ namespace Modex
 			const auto title = shift_down ? Translate("RESET_INVENTORY") : Translate("CLEAR_INVENTORY");
 			const auto description = shift_down ? Translate("RESET_INVENTORY_DESC") : Translate("CLEAR_INVENTORY_DESC");
 
-			ImGui::PushStyleColor(ImGuiCol_Button, ThemeConfig::GetColor("DECLINE"));
-			ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ThemeConfig::GetHover("DECLINE"));
-			ImGui::PushStyleColor(ImGuiCol_ButtonActive, ThemeConfig::GetActive("DECLINE"));
+			ImGui::PushStyleColor(ImGuiCol_Button, ThemeConfig::GetColor(ThemeColor::Decline));
+			ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ThemeConfig::GetHover(ThemeColor::Decline));
+			ImGui::PushStyleColor(ImGuiCol_ButtonActive, ThemeConfig::GetActive(ThemeColor::Decline));
 			if (UICustom::ActionButton(title, ImVec2(max_width, button_height), !Commands::IsGameMenuOpen() && a_view->IsValidTargetReference())) {
 				UIManager::GetSingleton()->ShowWarning(Translate("CLEAR_INVENTORY"), description, true, [&a_view, shift_down]() {
 					if (auto target = a_view->GetTableTargetRef(); target) {
@@ -134,9 +134,9 @@ namespace Modex
 
 			UICustom::SubCategoryHeader(Translate("HEADER_ACTIONS"));
 
-			ImGui::PushStyleColor(ImGuiCol_Button, ThemeConfig::GetColor("SECONDARY"));
-			ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ThemeConfig::GetHover("SECONDARY"));
-			ImGui::PushStyleColor(ImGuiCol_ButtonActive, ThemeConfig::GetActive("SECONDARY"));
+			ImGui::PushStyleColor(ImGuiCol_Button, ThemeConfig::GetColor(ThemeColor::Secondary));
+			ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ThemeConfig::GetHover(ThemeColor::Secondary));
+			ImGui::PushStyleColor(ImGuiCol_ButtonActive, ThemeConfig::GetActive(ThemeColor::Secondary));
 			if (UICustom::ActionButton("CONTAINER_VIEW_TARGET", ImVec2(max_width, button_height), valid_table_target)) {
 				Commands::OpenActorInventory(a_view->GetTableTargetRef());
 			}
@@ -217,15 +217,15 @@ namespace Modex
 			const float max_width = ImGui::GetContentRegionAvail().x;
 			const bool action_allowed = a_view->IsActionAllowed();
 			const auto shift_down = ImGui::GetIO().KeyShift;
-			const auto& selection = a_view->GetSelection();
+			const auto& selection = a_view->GetSelectedItems();
 
 			UICustom::SubCategoryHeader(Translate("HEADER_ACTIONS"));
 
-			ImGui::PushStyleColor(ImGuiCol_Button, ThemeConfig::GetColor("SECONDARY"));
-			ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ThemeConfig::GetHover("SECONDARY"));
-			ImGui::PushStyleColor(ImGuiCol_ButtonActive, ThemeConfig::GetActive("SECONDARY"));
+			ImGui::PushStyleColor(ImGuiCol_Button, ThemeConfig::GetColor(ThemeColor::Secondary));
+			ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ThemeConfig::GetHover(ThemeColor::Secondary));
+			ImGui::PushStyleColor(ImGuiCol_ButtonActive, ThemeConfig::GetActive(ThemeColor::Secondary));
 			if (UICustom::ActionButton("CONTAINER_VIEW", ImVec2(max_width, button_height), action_allowed && a_view->GetSelectionCount() == 1)) {
-				if (auto form = a_view->GetSelection()[0]->GetTESForm(); form) {
+				if (auto form = selection[0]->GetTESForm(); form) {
 					if (auto outfit = form->As<RE::BGSOutfit>(); outfit) {
 						PlayerChestSpawn::GetSingleton()->PopulateChestWithOutfit(outfit, s_outfitLevel);
 					}
@@ -249,7 +249,7 @@ namespace Modex
 			// fall out of scope when we popup a window.
 
 			if (!new_kit_name.empty() && a_view->GetSelectionCount() == 1) {
-				if (auto form = a_view->GetSelection()[0]->GetTESForm(); form) {
+				if (auto form = selection[0]->GetTESForm(); form) {
 					if (auto outfit = form->As<RE::BGSOutfit>(); outfit) {
 						EquipmentConfig::CreateKitFromOutfit(new_kit_name, outfit, s_outfitLevel);
 					}
@@ -301,9 +301,9 @@ namespace Modex
 			const auto title = shift_down ? Translate("RESET_INVENTORY") : Translate("CLEAR_INVENTORY");
 			const auto description = shift_down ? Translate("RESET_INVENTORY_DESC") : Translate("CLEAR_INVENTORY_DESC");
 
-			ImGui::PushStyleColor(ImGuiCol_Button, ThemeConfig::GetColor("DECLINE"));
-			ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ThemeConfig::GetHover("DECLINE"));
-			ImGui::PushStyleColor(ImGuiCol_ButtonActive, ThemeConfig::GetActive("DECLINE"));
+			ImGui::PushStyleColor(ImGuiCol_Button, ThemeConfig::GetColor(ThemeColor::Decline));
+			ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ThemeConfig::GetHover(ThemeColor::Decline));
+			ImGui::PushStyleColor(ImGuiCol_ButtonActive, ThemeConfig::GetActive(ThemeColor::Decline));
 
 			if (UICustom::ActionButton(title, ImVec2(max_width, button_height), !Commands::IsGameMenuOpen() && a_view->IsValidTargetReference())) {
 				UIManager::GetSingleton()->ShowWarning(Translate("CLEAR_INVENTORY"), description, true, [&a_view, shift_down]() {
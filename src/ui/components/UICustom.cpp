@@ -28,43 +28,43 @@ namespace Modex::UICustom
 		auto alpha = ImGui::GetStyle().Alpha;
 		switch (a_type) {
 		case RE::FormType::Armor:
-			return ThemeConfig::GetColorU32("ARMO", alpha);
+			return ThemeConfig::GetColorU32(ThemeColor::TypeArmor, alpha);
 		case RE::FormType::AlchemyItem:
-			return ThemeConfig::GetColorU32("ALCH", alpha);
+			return ThemeConfig::GetColorU32(ThemeColor::TypeAlchemy, alpha);
 		case RE::FormType::Ammo:
-			return ThemeConfig::GetColorU32("AMMO", alpha);
+			return ThemeConfig::GetColorU32(ThemeColor::TypeAmmo, alpha);
 		case RE::FormType::Book:
-			return ThemeConfig::GetColorU32("BOOK", alpha);
+			return ThemeConfig::GetColorU32(ThemeColor::TypeBook, alpha);
 		case RE::FormType::Ingredient:
-			return ThemeConfig::GetColorU32("INGR", alpha);
+			return ThemeConfig::GetColorU32(ThemeColor::TypeIngredient, alpha);
 		case RE::FormType::KeyMaster:
-			return ThemeConfig::GetColorU32("KEYM", alpha);
+			return ThemeConfig::GetColorU32(ThemeColor::TypeKey, alpha);
 		case RE::FormType::Misc:
-			return ThemeConfig::GetColorU32("MISC", alpha);
+			return ThemeConfig::GetColorU32(ThemeColor::TypeMisc, alpha);
 		case RE::FormType::Scroll:
-			return ThemeConfig::GetColorU32("SCRL", alpha);
+			return ThemeConfig::GetColorU32(ThemeColor::TypeScroll, alpha);
 		case RE::FormType::Weapon:
-			return ThemeConfig::GetColorU32("WEAP", alpha);
+			return ThemeConfig::GetColorU32(ThemeColor::TypeWeapon, alpha);
 		case RE::FormType::NPC:
-			return ThemeConfig::GetColorU32("NPC_", alpha);
+			return ThemeConfig::GetColorU32(ThemeColor::TypeNPC, alpha);
 		case RE::FormType::Tree:
-			return ThemeConfig::GetColorU32("TREE", alpha);
+			return ThemeConfig::GetColorU32(ThemeColor::TypeTree, alpha);
 		case RE::FormType::Static:
-			return ThemeConfig::GetColorU32("STAT", alpha);
+			return ThemeConfig::GetColorU32(ThemeColor::TypeStatic, alpha);
 		case RE::FormType::Container:
-			return ThemeConfig::GetColorU32("CONT", alpha);
+			return ThemeConfig::GetColorU32(ThemeColor::TypeContainer, alpha);
 		case RE::FormType::Activator:
-			return ThemeConfig::GetColorU32("ACTI", alpha);
+			return ThemeConfig::GetColorU32(ThemeColor::TypeActivator, alpha);
 		case RE::FormType::Light:
-			return ThemeConfig::GetColorU32("LIGH", alpha);
+			return ThemeConfig::GetColorU32(ThemeColor::TypeLight, alpha);
 		case RE::FormType::Door:
-			return ThemeConfig::GetColorU32("DOOR", alpha);
+			return ThemeConfig::GetColorU32(ThemeColor::TypeDoor, alpha);
 		case RE::FormType::Furniture:
-			return ThemeConfig::GetColorU32("FURN", alpha);
+			return ThemeConfig::GetColorU32(ThemeColor::TypeFurniture, alpha);
 		case RE::FormType::Outfit:
-			return ThemeConfig::GetColorU32("OTFT", alpha);
+			return ThemeConfig::GetColorU32(ThemeColor::TypeOutfit, alpha);
 		case RE::FormType::LeveledItem:
-			return ThemeConfig::GetColorU32("LVLI", alpha);
+			return ThemeConfig::GetColorU32(ThemeColor::TypeLeveledItem, alpha);
 		default:
 			return IM_COL32(169, 169, 169, 100 * alpha);  // Dark Gray
 		}
@@ -128,9 +128,8 @@ namespace Modex::UICustom
 		}
 
 		if (ImGui::IsItemHovered(ImGuiHoveredFlags_DelayNormal | ImGuiHoveredFlags_NoSharedDelay | ImGuiHoveredFlags_AllowWhenDisabled)) {
-			const auto tooltip_key = std::string(a_translate) + "_TOOLTIP";
-			if (Locale::GetSingleton()->HasEntry(tooltip_key.c_str())) {
-				UICustom::FancyTooltip(tooltip_key.c_str());
+			if (const char* tooltip = Locale::GetSingleton()->GetTooltip(a_translate); *tooltip) {
+				UICustom::FancyTooltipText(tooltip);
 			}
 		}
 
@@ -167,7 +166,7 @@ namespace Modex::UICustom
 		pos.x += a_width - ImGui::GetFrameHeightWithSpacing() + ImGui::GetStyle().FramePadding.x;
 		pos.y += (ImGui::GetItemRectSize().y / 2.0f) - (ImGui::GetFontSize() / 2.0f);
 
-		DrawList->AddText(pos, ThemeConfig::GetColorU32("TEXT", ImGui::GetStyle().Alpha), ICON_LC_SEARCH);
+		DrawList->AddText(pos, ThemeConfig::GetColorU32(ThemeColor::Text, ImGui::GetStyle().Alpha), ICON_LC_SEARCH);
 		ImGui::PopFont();
 		
 		ImGui::PopStyleVar(2);
@@ -243,7 +242,7 @@ namespace Modex::UICustom
 		pos.x += a_width - ImGui::GetFrameHeightWithSpacing() + ImGui::GetStyle().FramePadding.x;
 		pos.y += (ImGui::GetItemRectSize().y / 2.0f) - (ImGui::GetFontSize() / 2.0f);
 
-		DrawList->AddText(pos, ThemeConfig::GetColorU32("TEXT", ImGui::GetStyle().Alpha), ICON_LC_SQUARE_CHEVRON_DOWN);
+		DrawList->AddText(pos, ThemeConfig::GetColorU32(ThemeColor::Text, ImGui::GetStyle().Alpha), ICON_LC_SQUARE_CHEVRON_DOWN);
 		ImGui::PopFont();
 
 		ImGui::PopStyleVar(2);
@@ -251,6 +250,11 @@ namespace Modex::UICustom
 	}
 
 	void FancyTooltip(const char* a_localeString)
+	{
+		FancyTooltipText(Translate(a_localeString));
+	}
+
+	void FancyTooltipText(const char* a_text)
 	{
 		const float width = ImGui::GetIO().DisplaySize.x * 0.20f;
 
@@ -267,12 +271,12 @@ namespace Modex::UICustom
 			const ImVec2 pos = ImGui::GetCursorScreenPos();
 			const ImVec2 size = ImGui::GetWindowSize();
 			
-			ImGui::TextWrapped("%s", Translate(a_localeString));
+			ImGui::TextWrapped("%s", a_text);
 
 			drawList->AddRectFilled(
 				ImVec2(pos.x - ImGui::GetStyle().WindowPadding.x, pos.y + (ImGui::GetFontSize() * 1.5f)),
 				ImVec2(pos.x + size.x, pos.y + (ImGui::GetFontSize() * 1.5f) + 1.0f),
-				ThemeConfig::GetColorU32("PRIMARY"));
+				ThemeConfig::GetColorU32(ThemeColor::Primary));
 
 			ImGui::EndTooltip();
 		}
@@ -387,7 +391,7 @@ namespace Modex::UICustom
 	bool ToggleButton(const char* a_id, bool& a_toggle, float a_width)
 	{
 		ImGui::PushID(a_id);
-		const std::string& button_color = a_toggle == true ? "CONFIRM" : "DECLINE";
+		const ThemeColor button_color = a_toggle == true ? ThemeColor::Confirm : ThemeColor::Decline;
 		const std::string button_text = a_toggle == true ? Translate("ON") : Translate("OFF"); 
 
 		ImGui::PushStyleColor(ImGuiCol_Button, ThemeConfig::GetColor(button_color));
@@ -411,7 +415,7 @@ namespace Modex::UICustom
 		auto id = "##Settings::ToggleButton::" + std::string(a_localeString);
 		
 		ImGui::PushID(id.c_str());
-		const std::string& button_color = a_toggle == true ? "CONFIRM" : "DECLINE";
+		const ThemeColor button_color = a_toggle == true ? ThemeColor::Confirm : ThemeColor::Decline;
 		const std::string button_text = a_toggle == true ? Translate("ON") : Translate("OFF"); 
 
 		ImGui::AlignTextToFramePadding();
@@ -574,7 +578,7 @@ namespace Modex::UICustom
 				ImTextureID modTexture = (ImTextureID)(intptr_t)modImg.texture;
 				ImVec4 modTint = hovered ? ImVec4(0.9f, 0.9f, 0.9f, 0.9f) : ImVec4(1.f, 1.f, 1.f, 1.f);
 				drawList->AddImage(modTexture, ImVec2(cursorX, buttonPos.y), ImVec2(cursorX + modWidth, buttonPos.y + imageHeight),
-					ImVec2(0, 0), ImVec2(1, 1), ImGui::GetColorU32(modTint));
+					modImg.uv0, modImg.uv1, ImGui::GetColorU32(modTint));
 				cursorX += modWidth;
 
 				// Draw "+" text centered vertically.
@@ -586,7 +590,7 @@ namespace Modex::UICustom
 			ImTextureID keyTexture = (ImTextureID)(intptr_t)keyImg.texture;
 			ImVec4 keyTint = hovered ? ImVec4(0.9f, 0.9f, 0.9f, 0.9f) : ImVec4(1.f, 1.f, 1.f, 1.f);
 			drawList->AddImage(keyTexture, ImVec2(cursorX, buttonPos.y), ImVec2(cursorX + keyWidth, buttonPos.y + imageHeight),
-				ImVec2(0, 0), ImVec2(1, 1), ImGui::GetColorU32(keyTint));
+				keyImg.uv0, keyImg.uv1, ImGui::GetColorU32(keyTint));
 
 			// T-key reset on hover.
 			if (hovered) {
@@ -735,7 +739,7 @@ namespace Modex::UICustom
 	void Settings_Header(const char* a_localeString)
 	{
 		ImGui::PushFontBold();
-		ImGui::PushStyleColor(ImGuiCol_Text, ThemeConfig::GetColor("PRIMARY"));
+		ImGui::PushStyleColor(ImGuiCol_Text, ThemeConfig::GetColor(ThemeColor::Primary));
 		ImGui::SeparatorText(Translate(a_localeString));
 		ImGui::PopStyleColor();
 		ImGui::PopFont();
@@ -786,13 +790,13 @@ namespace Modex::UICustom
 	{
 		const float button_width = (ImGui::GetContentRegionAvail().x - ImGui::GetStyle().ItemSpacing.x) * 0.5f;
 
-		ImGui::PushStyleColor(ImGuiCol_Button, m_navAccept ? ThemeConfig::GetHover("CONFIRM") : ThemeConfig::GetColor("CONFIRM"));
+		ImGui::PushStyleColor(ImGuiCol_Button, m_navAccept ? ThemeConfig::GetHover(ThemeColor::Confirm) : ThemeConfig::GetColor(ThemeColor::Confirm));
 		bool confirm = ImGui::Button(Translate("CONFIRM"), ImVec2(button_width, ImGui::GetFrameHeightWithSpacing()));
 		ImGui::PopStyleColor();
 		
 		ImGui::SameLine();
 
-		ImGui::PushStyleColor(ImGuiCol_Button, m_navAccept ? ThemeConfig::GetColor("DECLINE") : ThemeConfig::GetHover("DECLINE"));
+		ImGui::PushStyleColor(ImGuiCol_Button, m_navAccept ? ThemeConfig::GetColor(ThemeColor::Decline) : ThemeConfig::GetHover(ThemeColor::Decline));
 		bool decline = ImGui::Button(Translate("CANCEL"), ImVec2(button_width, ImGui::GetFrameHeightWithSpacing()));
 		ImGui::PopStyleColor();
 
@@ -821,7 +825,7 @@ namespace ImGui
 			ImGui::TextDisabled(ICON_LC_MESSAGE_CIRCLE_QUESTION);
 
 			if (ImGui::IsItemHovered(ImGuiHoveredFlags_NoSharedDelay | ImGuiHoveredFlags_DelayNone)) {
-				Modex::UICustom::FancyTooltip(tooltip);
+				Modex::UICustom::FancyTooltipText(tooltip);
 			}
 		}
 	}
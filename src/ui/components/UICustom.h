@@ -11,6 +11,7 @@ namespace Modex::UICustom
 	bool ActionButton(const char* a_translate, const ImVec2& a_size, const bool a_condition);
 
 	void FancyTooltip(const char* a_localeString);
+	void FancyTooltipText(const char* a_text); // already translated, drawn as-is
 	bool FancyInputText(const char* a_id, const char* a_hint, const char* a_tooltip, char* a_buffer, float a_width, ImGuiInputTextFlags a_flags = 0);
 	bool FancyDropdown(const char* a_id, const char* a_tooltip, uint32_t& a_currentItem, const std::vector<std::string>& a_items, float a_width);
 	bool FancyDropdown(const char* a_id, const char* a_tooltip, int& a_currentItem, const std::vector<std::string>& a_items, float a_width);
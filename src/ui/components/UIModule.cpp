@@ -44,7 +44,7 @@ namespace Modex
 
         // Tab Button Area
 		if (UICustom::BeginTabBar("#Modex::Layout::TabBar", button_height, m_offset, start_pos)) {
-			ImGui::PushStyleColor(ImGuiCol_Header, ThemeConfig::GetColor("PRIMARY"));
+			ImGui::PushStyleColor(ImGuiCol_Header, ThemeConfig::GetColor(ThemeColor::Primary));
 			ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(.0f, .0f));
 			for (const auto& layout : m_layouts) {
 				const auto selected = layout.selected;
@@ -78,7 +78,7 @@ namespace Modex
 		ImGui::SetCursorPos(start_pos);
 
 		// Tab Bar Separator
-		ImGui::PushStyleColor(ImGuiCol_Separator, ThemeConfig::GetColor("PRIMARY"));
+		ImGui::PushStyleColor(ImGuiCol_Separator, ThemeConfig::GetColor(ThemeColor::Primary));
 		ImGui::SeparatorEx(ImGuiSeparatorFlags_Horizontal, 2.0f);
 		ImGui::PopStyleColor();
 
@@ -1,5 +1,7 @@
 #include "UINotification.h"
 
+#include <cstring>
+
 #include "config/UserConfig.h"
 #include "config/ThemeConfig.h"
 #include "external/icons/IconsLucide.h"
@@ -10,10 +12,29 @@
 
 namespace Modex 
 {
+	namespace
+	{
+		// Copies into a fixed buffer, backing off so a multi-byte UTF-8 sequence is never split.
+		template <size_t N>
+		void CopyText(char (&a_dest)[N], std::string_view a_src)
+		{
+			size_t length = (std::min)(a_src.size(), N - 1);
+
+			if (length < a_src.size()) {
+				while (length > 0 && (static_cast<unsigned char>(a_src[length]) & 0xC0) == 0x80) {
+					length--;
+				}
+			}
+
+			std::memcpy(a_dest, a_src.data(), length);
+			a_dest[length] = '\0';
+		}
+	}
+
 	void UINotification::ShowTooltip(const std::string& a_text, const std::string& a_icon)
 	{
-		s_tooltip.text = a_text.empty() ? "" : Translate(a_text.c_str());
-		s_tooltip.icon = a_icon.empty() ? ICON_LC_INFO : a_icon;
+		CopyText(s_tooltip.text, a_text.empty() ? "" : Translate(a_text.c_str()));
+		CopyText(s_tooltip.icon, a_icon.empty() ? ICON_LC_INFO : a_icon);
 		s_tooltip.type = UIMessageType::Tooltip;
 		s_tooltip.active = true;
 		s_tooltip.duration = 1.0f; // Linger Time
@@ -39,40 +60,123 @@ namespace Modex
 		if (Locale::GetSingleton()->HasEntry(key.c_str())) ShowTooltip(tooltip, icon);
 	}
 
-	void UINotification::ShowAction(const std::string& a_action, const std::string& a_target, const char* a_icon, UIMessageType a_type, float a_duration)
+	void UINotification::ShowAction(std::string_view a_action, std::string_view a_target, const char* a_icon, UIMessageType a_type, float a_duration, uint32_t a_quantity, std::span<const RE::FormID> a_forms)
 	{
-		PushMessage(std::format("{} {} {}", a_action, ICON_LC_ARROW_RIGHT, a_target), a_icon, a_type, a_duration);
+		const char* icon = a_icon ? a_icon : "";
+
+		// Bulk commands and repeated clicks land here in bursts; fold them into the newest row
+		// when they hit the same target. Targets are compared as stored, so truncation is shared.
+		if (s_count > 0 && !a_action.empty()) {
+			auto& last = s_messages[s_count - 1];
+			char target[TARGET_LENGTH];
+			CopyText(target, a_target);
+
+			if (last.active && last.type == a_type && a_action == last.action && std::strcmp(icon, last.icon) == 0 &&
+				std::strcmp(target, last.target) == 0 && std::chrono::steady_clock::now() - last.timestamp < AGGREGATE_WINDOW) {
+				last.quantity += a_quantity;
+				last.timestamp = std::chrono::steady_clock::now();
+				last.duration = (std::max)(last.duration, a_duration);
+				AddForms(last, a_forms);
+				FormatActionText(last);
+				return;
+			}
+		}
+
+		auto& msg = AcquireMessage(a_type, a_duration);
+		CopyText(msg.icon, icon);
+		CopyText(msg.action, a_action);
+		CopyText(msg.target, a_target);
+		msg.quantity = a_quantity;
+		AddForms(msg, a_forms);
+		FormatActionText(msg);
 	}
 
-	void UINotification::ShowError(const std::string& a_text, float a_duration)
+	void UINotification::ShowError(std::string_view a_text, float a_duration)
 	{
 		PushMessage(a_text, ICON_LC_TRIANGLE_ALERT, UIMessageType::Error, a_duration);
 	}
 
-	void UINotification::PushMessage(const std::string& a_text, const std::string& a_icon, UIMessageType a_type, float a_duration)
+	void UINotification::AddForms(UIMessage& a_msg, std::span<const RE::FormID> a_forms)
+	{
+		for (const RE::FormID form : a_forms) {
+			const size_t listed = (std::min)(static_cast<size_t>(a_msg.formCount), FORM_LENGTH);
+			const auto end = a_msg.forms.begin() + listed;
+
+			if (std::find(a_msg.forms.begin(), end, form) != end) {
+				continue;
+			}
+
+			if (listed < FORM_LENGTH) {
+				a_msg.forms[listed] = form;
+			}
+
+			a_msg.formCount++;
+		}
+	}
+
+	void UINotification::FormatActionText(UIMessage& a_msg)
+	{
+		std::format_to_n_result<char*> result;
+
+		if (a_msg.formCount > 1) {
+			result = std::format_to_n(a_msg.text, TEXT_LENGTH - 1, "{} {} {} ({} {}, {} {})", a_msg.action, ICON_LC_ARROW_RIGHT, a_msg.target,
+				a_msg.quantity, Translate("NOTIFY_ITEMS"), a_msg.formCount, Translate("NOTIFY_TYPES"));
+		} else if (a_msg.quantity > 1) {
+			result = std::format_to_n(a_msg.text, TEXT_LENGTH - 1, "{} {} {} (x{})", a_msg.action, ICON_LC_ARROW_RIGHT, a_msg.target, a_msg.quantity);
+		} else {
+			result = std::format_to_n(a_msg.text, TEXT_LENGTH - 1, "{} {} {}", a_msg.action, ICON_LC_ARROW_RIGHT, a_msg.target);
+		}
+
+		*result.out = '\0';
+	}
+
+	// Reuses the oldest slot when the queue is full.
+	UINotification::UIMessage& UINotification::AcquireMessage(UIMessageType a_type, float a_duration)
 	{
-		if (s_messages.size() >= MAX_QUEUE) {
-			s_messages.pop_front();
+		if (s_count >= MAX_QUEUE) {
+			std::rotate(s_messages.begin(), s_messages.begin() + 1, s_messages.end());
+			s_count = MAX_QUEUE - 1;
 		}
 
-		s_messages.emplace_back(a_text, a_icon, a_type, a_duration);
+		auto& msg = s_messages[s_count++];
+		msg.Clear();
+		msg.type = a_type;
+		msg.duration = a_duration;
+		msg.timestamp = std::chrono::steady_clock::now();
+		msg.active = true;
+		return msg;
+	}
+
+	void UINotification::PushMessage(std::string_view a_text, const char* a_icon, UIMessageType a_type, float a_duration)
+	{
+		auto& msg = AcquireMessage(a_type, a_duration);
+		CopyText(msg.text, a_text);
+		CopyText(msg.icon, a_icon ? a_icon : "");
 	}
 
 	void UINotification::RemoveMessage(size_t a_index)
 	{
-		if (a_index < s_messages.size()) {
-			s_messages.erase(s_messages.begin() + a_index);
+		if (a_index < s_count) {
+			std::rotate(s_messages.begin() + a_index, s_messages.begin() + a_index + 1, s_messages.begin() + s_count);
+			s_count--;
 		}
 	}
 
 	void UINotification::Update()
 	{
-		s_messages.erase(
-				std::remove_if(s_messages.begin(), s_messages.end(),
-					[](const UIMessage& a_msg) {
-					return a_msg.IsExpired();
-				}),
-		s_messages.end());
+		size_t kept = 0;
+
+		for (size_t i = 0; i < s_count; i++) {
+			if (!s_messages[i].IsExpired()) {
+				if (kept != i) {
+					s_messages[kept] = s_messages[i];
+				}
+
+				kept++;
+			}
+		}
+
+		s_count = kept;
 	}
 
 	void UINotification::DrawProgressBar(const UIMessage& a_msg, float a_width, float a_height, float a_alpha)
@@ -90,7 +194,7 @@ namespace Modex
 		ImGui::GetWindowDrawList()->AddRectFilled(
 				progress_min,
 				progress_max,
-				ThemeConfig::GetColorU32("TEXT", 0.5f * a_alpha)
+				ThemeConfig::GetColorU32(ThemeColor::Text, 0.5f * a_alpha)
 		);
 	}
 
@@ -112,7 +216,7 @@ namespace Modex
 		Update();
 
 		const size_t MAX_COUNT = 10;
-		auto messagesToShow = min(s_messages.size(), MAX_COUNT);
+		auto messagesToShow = min(s_count, MAX_COUNT);
 
 		if (messagesToShow == 0) return;
 
@@ -147,7 +251,7 @@ namespace Modex
 			return;
 		}
 
-		if (!s_messages.empty()) return;
+		if (s_count > 0) return;
 
 		const float msg_height = ImGui::GetFrameHeight() * 1.5f;
 		const float window_width = a_parentSize.x;
@@ -180,13 +284,13 @@ namespace Modex
 			ImGui::SetCursorPosX(ImGui::GetStyle().WindowPadding.x + 2.0f);
 
 			// Icon
-			if (!a_msg.icon.empty()) {
-				ImGui::Text("%s", a_msg.icon.c_str());
+			if (a_msg.icon[0] != '\0') {
+				ImGui::Text("%s", a_msg.icon);
 				ImGui::SameLine(ImGui::GetFrameHeight());
 			}
 
 			// Message
-			ImGui::Text("%s", TRUNCATE(a_msg.text.c_str(), a_width / 1.5f).c_str());
+			ImGui::Text("%s", TRUNCATE(a_msg.text, a_width / 1.5f).c_str());
 
 			// Previous style implementation: unused for now.
 			// DrawProgressBar(a_msg, a_width, a_height, alpha);
@@ -208,11 +312,11 @@ namespace Modex
 			const auto draw_list = ImGui::GetWindowDrawList();
 			draw_list->AddRectFilled(ImGui::GetWindowPos(), ImGui::GetWindowPos() + ImVec2(a_width, a_height), bgColor, 0.0f);
 			// Enlarge Tooltip Icon
-			if (!a_msg.icon.empty()) {
+			if (a_msg.icon[0] != '\0') {
 				ImGui::SetCursorPosX(ImGui::GetCursorPosX() + ImGui::GetFrameHeight() / 2.0f);
 				ImGui::PushFont(NULL, ImGui::GetFontSize() + 4.0f);
-				ImGui::SetCursorPosY((a_height / 2.0f) - (ImGui::CalcTextSize(a_msg.icon.c_str()).y / 2.0f));
-				ImGui::Text("%s", a_msg.icon.c_str());
+				ImGui::SetCursorPosY((a_height / 2.0f) - (ImGui::CalcTextSize(a_msg.icon).y / 2.0f));
+				ImGui::Text("%s", a_msg.icon);
 				ImGui::PopFont();
 				ImGui::SameLine();
 			}
@@ -221,7 +325,7 @@ namespace Modex
 			const float center_x = UICustom::GetCenterTextPosX(a_msg.text);
 			ImGui::SetCursorPosY((a_height / 2.0f) - (ImGui::GetFontSize() / 2.0f));
 			ImGui::SetCursorPosX(center_x);
-			ImGui::Text("%s", a_msg.text.c_str());
+			ImGui::Text("%s", a_msg.text);
 		}
 
 		ImGui::EndChild();
@@ -231,13 +335,13 @@ namespace Modex
 	{
 		switch (a_type) {
 		case UIMessageType::Info:
-			return ThemeConfig::GetColorU32("PRIMARY", a_alpha);
+			return ThemeConfig::GetColorU32(ThemeColor::Primary, a_alpha);
 		case UIMessageType::Warning:
-			return ThemeConfig::GetColorU32("WARN", a_alpha);
+			return ThemeConfig::GetColorU32(ThemeColor::Warn, a_alpha);
 		case UIMessageType::Error:
-			return ThemeConfig::GetColorU32("ERROR", a_alpha);
+			return ThemeConfig::GetColorU32(ThemeColor::Error, a_alpha);
 		case UIMessageType::Tooltip:
-			return ThemeConfig::GetColorU32("FRAME", a_alpha);
+			return ThemeConfig::GetColorU32(ThemeColor::Frame, a_alpha);
 		default:
 			return ImGui::GetColorU32(ImGuiCol_Text);
 		}
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <array>
+#include <span>
+
 #include "data/BaseObject.h"
 #include "imgui.h"
 
@@ -19,35 +22,44 @@ namespace Modex
 	class UINotification 
 	{
 	private:
+		// Messages live in fixed buffers so pushing or merging one never allocates.
+		static inline constexpr size_t TEXT_LENGTH = 256;
+		static inline constexpr size_t ACTION_LENGTH = 64;
+		static inline constexpr size_t TARGET_LENGTH = 128;
+		static inline constexpr size_t ICON_LENGTH = 8;
+
+		// Distinct forms are counted exactly up to this many per message; past it, every form
+		// that isn't already listed counts as new.
+		static inline constexpr size_t FORM_LENGTH = 64;
+
 		struct UIMessage
 		{
-			std::string text;
-			std::string icon;
+			char text[TEXT_LENGTH];
+			char icon[ICON_LENGTH];
+			char action[ACTION_LENGTH];
+			char target[TARGET_LENGTH];
+			std::array<RE::FormID, FORM_LENGTH> forms;
+			uint32_t formCount;
+			uint32_t quantity;
 			UIMessageType type;
 			std::chrono::steady_clock::time_point timestamp;
 			float duration;
 			bool active;
 
-			// Default Tooltip Constructor
 			UIMessage()
-				: text("")
-				, icon("")
+				: text{}
+				, icon{}
+				, action{}
+				, target{}
+				, forms{}
+				, formCount(0)
+				, quantity(0)
 				, type(UIMessageType::None)
 				, timestamp(std::chrono::steady_clock::now())
 				, duration(0.0f)
 				, active(false)
 			{}
 
-			// Notification Message Constructor
-			UIMessage(const std::string& a_text, const std::string& a_icon, UIMessageType a_type, float a_duration)
-				: text(a_text)
-				, icon(a_icon)
-				, type(a_type)
-				, timestamp(std::chrono::steady_clock::now())
-				, duration(a_duration)
-				, active(true)
-			{}
-
 			float GetElapsed() const {
 				if (!active || duration < 0.0f) return 0.0f;
 
@@ -88,8 +100,12 @@ namespace Modex
 
 			void Clear()
 			{
-				text.clear();
-				icon.clear();
+				text[0] = '\0';
+				icon[0] = '\0';
+				action[0] = '\0';
+				target[0] = '\0';
+				formCount = 0;
+				quantity = 0;
 				type = UIMessageType::None;
 				active = false;
 			}
@@ -113,11 +129,18 @@ namespace Modex
 			ImGuiWindowFlags_NoMouseInputs |
 			ImGuiWindowFlags_NoNav;
 
-		static inline std::deque<UIMessage> s_messages;
-		static inline UIMessage s_tooltip;
 		static inline constexpr size_t MAX_QUEUE = 10;
 		static inline constexpr size_t MAX_DISPLAY = 1;
 
+		// Actions with the same label, target, icon and type arriving within this window of the
+		// newest message are folded into it instead of queueing a new row.
+		static inline constexpr std::chrono::milliseconds AGGREGATE_WINDOW{ 750 };
+
+		// Oldest to newest; slots past s_count are stale and reused in place.
+		static inline std::array<UIMessage, MAX_QUEUE> s_messages;
+		static inline size_t s_count = 0;
+		static inline UIMessage s_tooltip;
+
 		UINotification() = delete;
 		~UINotification() = delete;
 
@@ -129,8 +152,10 @@ namespace Modex
 		static void ClearTooltip() { s_tooltip.Clear(); }
 		
 		// Helpers to push/set messages based on context.
-		static void ShowAction(const std::string& a_action, const std::string& a_target, const char* a_icon = ICON_LC_ITERATION_CCW, UIMessageType a_type = UIMessageType::Info, float a_duration = 3.0f);
-		static void ShowError(const std::string& a_text, float a_duration = 3.0f);
+		// a_quantity is how many items the action moved and a_forms which forms they were; merged
+		// messages sum the quantity and count distinct forms, e.g. "(347 items, 12 types)".
+		static void ShowAction(std::string_view a_action, std::string_view a_target, const char* a_icon = ICON_LC_ITERATION_CCW, UIMessageType a_type = UIMessageType::Info, float a_duration = 3.0f, uint32_t a_quantity = 1, std::span<const RE::FormID> a_forms = {});
+		static void ShowError(std::string_view a_text, float a_duration = 3.0f);
 
 		// Container & Message Rendering
 		static void DrawTooltip(const UIMessage& a_msg, float a_height, float a_width);
@@ -141,10 +166,13 @@ namespace Modex
 		// Core
 		static void Update();
 		static void RemoveMessage(size_t a_index);
-		static void ClearAll() { s_messages.clear(); }
+		static void ClearAll() { s_count = 0; }
 	
 	private:
-		static void PushMessage(const std::string& a_text, const std::string& a_icon, UIMessageType a_type, float a_duration);
+		static UIMessage& AcquireMessage(UIMessageType a_type, float a_duration);
+		static void PushMessage(std::string_view a_text, const char* a_icon, UIMessageType a_type, float a_duration);
+		static void AddForms(UIMessage& a_msg, std::span<const RE::FormID> a_forms);
+		static void FormatActionText(UIMessage& a_msg);
 		static void DrawProgressBar(const UIMessage& a_msg, float a_width, float a_height, float a_alpha);
 
 		static Container SetupContainer(const ImVec2& a_pos, const ImVec2& a_size, int a_padding);
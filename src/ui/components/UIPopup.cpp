@@ -39,9 +39,9 @@ namespace Modex
 
 			ImGui::SeparatorEx(ImGuiSeparatorFlags_Horizontal);
 
-			ImGui::PushStyleColor(ImGuiCol_Button, ThemeConfig::GetColor("DECLINE"));
-			ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ThemeConfig::GetHover("DECLINE"));
-			ImGui::PushStyleColor(ImGuiCol_ButtonActive, ThemeConfig::GetActive("DECLINE"));
+			ImGui::PushStyleColor(ImGuiCol_Button, ThemeConfig::GetColor(ThemeColor::Decline));
+			ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ThemeConfig::GetHover(ThemeColor::Decline));
+			ImGui::PushStyleColor(ImGuiCol_ButtonActive, ThemeConfig::GetActive(ThemeColor::Decline));
 			if (ImGui::Button(Translate("CLOSE"), ImVec2(ImGui::GetContentRegionAvail().x, 0.f))) {
 				DeclineHotkey();
 			}
@@ -313,9 +313,9 @@ namespace Modex
 			ImGui::NewLine();
 			ImGui::SeparatorEx(ImGuiSeparatorFlags_Horizontal);
 
-			ImGui::PushStyleColor(ImGuiCol_Button, ThemeConfig::GetColor("CONFIRM"));
-			ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ThemeConfig::GetHover("CONFIRM"));
-			ImGui::PushStyleColor(ImGuiCol_ButtonActive, ThemeConfig::GetActive("CONFIRM"));
+			ImGui::PushStyleColor(ImGuiCol_Button, ThemeConfig::GetColor(ThemeColor::Confirm));
+			ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ThemeConfig::GetHover(ThemeColor::Confirm));
+			ImGui::PushStyleColor(ImGuiCol_ButtonActive, ThemeConfig::GetActive(ThemeColor::Confirm));
 			if (ImGui::Button(Translate("CONFIRM"), ImVec2(ImGui::GetContentRegionAvail().x, 0.f))) {
 				CloseInfo();
 			}
@@ -123,7 +123,7 @@ namespace Modex
 					ImGui::PopStyleVar();
 					
 					ImGui::TableNextColumn();
-					ImGui::TextColored(ThemeConfig::GetColor("TEXT"), "%08X", npc->GetRefID());
+					ImGui::TextColored(ThemeConfig::GetColor(ThemeColor::Text), "%08X", npc->GetRefID());
 					ImGui::PopID();
 				}
 				
@@ -169,9 +169,9 @@ namespace Modex
 
 			static char currentSearch[256] = "";
 			ImGui::SetNextItemWidth(ImGui::GetContentRegionAvail().x);
-			ImGui::PushStyleColor(ImGuiCol_FrameBg, ThemeConfig::GetColor("BG_LIGHT", m_alpha));
-			ImGui::PushStyleColor(ImGuiCol_FrameBgHovered, ThemeConfig::GetHover("BG_LIGHT", m_alpha));
-			ImGui::PushStyleColor(ImGuiCol_FrameBgActive, ThemeConfig::GetActive("BG_LIGHT", m_alpha));
+			ImGui::PushStyleColor(ImGuiCol_FrameBg, ThemeConfig::GetColor(ThemeColor::BgLight, m_alpha));
+			ImGui::PushStyleColor(ImGuiCol_FrameBgHovered, ThemeConfig::GetHover(ThemeColor::BgLight, m_alpha));
+			ImGui::PushStyleColor(ImGuiCol_FrameBgActive, ThemeConfig::GetActive(ThemeColor::BgLight, m_alpha));
 			if (UICustom::FancyInputText("##Modex::ReferenceLookup::InputText", "", "", currentSearch, ImGui::GetContentRegionAvail().x, ImGuiInputTextFlags_EnterReturnsTrue)) {
 				RE::FormID refID = 0;
 				if (TryParseFormID(currentSearch, refID)) {
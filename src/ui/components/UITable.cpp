@@ -1,6 +1,8 @@
 #include "UITable.h" 
 
+#include "core/CommandJournal.h"
 #include "core/Commands.h"
+#include "core/TaskScheduler.h"
 #include "data/BaseObject.h"
 #include "external/icons/IconsLucide.h"
 #include "imgui_internal.h"
@@ -20,6 +22,27 @@
 
 namespace Modex
 {
+	namespace
+	{
+		using ProfileClock = std::chrono::steady_clock;
+
+		float ElapsedMs(ProfileClock::time_point a_start)
+		{
+			return std::chrono::duration<float, std::milli>(ProfileClock::now() - a_start).count();
+		}
+
+		// Adds the lifetime of the scope to a_out. Passing nullptr skips the clock reads entirely,
+		// so per-row timers cost nothing while the profiler is hidden.
+		struct ScopedProfileTimer
+		{
+			float*                  out;
+			ProfileClock::time_point start;
+
+			explicit ScopedProfileTimer(float* a_out) : out(a_out), start(a_out ? ProfileClock::now() : ProfileClock::time_point{}) {}
+			~ScopedProfileTimer() { if (out) *out += ElapsedMs(start); }
+		};
+	}
+
 	bool UITable::IsValidTargetReference(RE::TESObjectREFR* a_reference) {
 		if (a_reference == nullptr) {
 			a_reference = tableTargetRef;
@@ -39,7 +62,7 @@ namespace Modex
 		if (GetSelectionCount() <= 0) {
 			return false;
 		} else {
-			for (const auto& item : GetSelection()) {
+			for (const auto* item : GetSelectedItems()) {
 				if (item == nullptr || item->IsDummy()) {
 					return false;
 				}
@@ -62,7 +85,8 @@ namespace Modex
 	bool UITable::IsValidSelectionReference() const
 	{
 		if (GetSelectionCount() == 1) {
-			return GetSelection().front() && !GetSelection().front()->IsDummy() && GetSelection().front()->GetRefID() != 0;
+			const BaseObject* lead = GetSelectionLead();
+			return lead && !lead->IsDummy() && lead->GetRefID() != 0;
 		} else {
 			return itemPreview != nullptr && !itemPreview->IsDummy() && itemPreview->GetRefID() != 0;
 		}
@@ -71,8 +95,8 @@ namespace Modex
 	RE::TESObjectREFR* UITable::GetSelectedReference() const
 	{
 		if (GetSelectionCount() == 1) {
-			if (GetSelection().front() && !GetSelection().front()->IsDummy()) {
-				auto id = GetSelection().front()->GetRefID();
+			if (const BaseObject* lead = GetSelectionLead(); lead && !lead->IsDummy()) {
+				auto id = lead->GetRefID();
 				return RE::TESForm::LookupByID<RE::TESObjectREFR>(id);
 			}
 		} else {
@@ -132,7 +156,7 @@ namespace Modex
 
 	void UITable::Setup()
 	{
-		filterSystem->SetSystemCallback([this]() { Refresh(); });
+		filterSystem->SetSystemCallback([this]() { RequestRefresh(RefreshReason_Filter); });
 
 		if (useSharedTarget) {
 			auto target = UIModule::GetTargetReference();
@@ -223,11 +247,11 @@ namespace Modex
 		pluginList.clear();
 		pluginSet.clear();
 
-		selectionStorage.Clear();
+		ClearSelection();
 		dragDropSourceList.clear();
 
 		// Clear raw pointers
-		itemPreview = nullptr;
+		SetItemPreview(nullptr);
 		tableTargetRef = nullptr;
 		selectedKitPtr = nullptr;
 	}
@@ -243,7 +267,7 @@ namespace Modex
 
 		// Inventory has in-method generator.
 		if (HasFlag(ModexTableFlag_Inventory)) {
-			this->Refresh();
+			this->RequestRefresh(RefreshReason_Target);
 		}
 
 		if (useSharedTarget)
@@ -278,7 +302,7 @@ namespace Modex
 	void UITable::UpdateActiveInventoryTables()
 	{
 		if (this->HasFlag(ModexTableFlag_Inventory) || this->GetDragDropHandle() == DragDropHandle::Inventory) {
-			this->Refresh();
+			this->RequestRefresh(RefreshReason_Inventory);
 			return;
 		}
 
@@ -287,11 +311,40 @@ namespace Modex
 			const auto ptr = pair.second;
 
 			if (ptr->HasFlag(ModexTableFlag_Inventory) || handle == DragDropHandle::Inventory) {
-				ptr->Refresh();
+				ptr->RequestRefresh(RefreshReason_Inventory);
 			}
 		}
 	}
 
+	// Resolves the selection (or the preview when nothing is selected) into forms once, on the
+	// UI side, so bulk actions can hand the whole set to a single batch command.
+	std::vector<Commands::BatchItem> UITable::CollectSelectionBatch(uint32_t a_count, const std::function<bool(const BaseObject*)>& a_predicate) const
+	{
+		std::vector<Commands::BatchItem> batch;
+
+		auto collect = [&](const BaseObject* a_item) {
+			if (!a_item || a_item->IsDummy() || !a_predicate(a_item))
+				return;
+
+			if (auto bound = a_item->GetTESForm()->As<RE::TESBoundObject>()) {
+				batch.push_back({ bound, a_count });
+			}
+		};
+
+		if (GetSelectionCount() == 0) {
+			collect(itemPreview.get());
+		} else {
+			const auto& selection = GetSelectedItems();
+			batch.reserve(selection.size());
+
+			for (const auto* item : selection) {
+				collect(item);
+			}
+		}
+
+		return batch;
+	}
+
 	void UITable::AddKitToTargetInventory(const Kit& a_kit)
     {
 		if (tableList.empty())
@@ -303,15 +356,25 @@ namespace Modex
 		if (!tableTargetRef)
 			return;
 
-		for (auto& kitItem : a_kit.m_items) {
-			if (kitItem->m_equipped) {
-				Commands::AddAndEquipItemToInventory(owner, tableTargetRef, kitItem->m_editorid);
+		// One batch, so the whole kit is a single journal entry and a single undo.
+		std::vector<Commands::BatchItem> batch;
+		batch.reserve(a_kit.m_items.size());
+
+		for (const auto& kitItem : a_kit.m_items) {
+			auto form = kitItem.GetForm();
+			auto bound = form ? form->As<RE::TESBoundObject>() : nullptr;
+
+			if (!bound)
+				continue;
+
+			if (kitItem.m_equipped) {
+				batch.push_back({ bound, 1, true });
 			} else {
-				Commands::AddItemToRefInventory(owner, tableTargetRef, kitItem->m_editorid, static_cast<std::uint32_t>(kitItem->m_amount));
+				batch.push_back({ bound, static_cast<std::uint32_t>(kitItem.m_amount) });
 			}
 		}
 
-		UpdateActiveInventoryTables();
+		Commands::AddItemsToInventory(owner, tableTargetRef, std::move(batch));
     }
 
 	void UITable::RemoveSelectionFromTargetInventory()
@@ -319,32 +382,15 @@ namespace Modex
 		if (tableList.empty())
 			return;
 
-
 		if (!tableTargetRef)
 			return;
 
-		if (GetSelectionCount() == 0)
-		{
-			if (itemPreview && !itemPreview->IsDummy() && itemPreview->GetTESForm()->IsInventoryObject()) {
-				Commands::RemoveItemFromInventory(owner, tableTargetRef, itemPreview->GetEditorID(), 1);
-			}
-		} 
-		else {
-			void* it = NULL;
-			ImGuiID id = 0;
-
-			while (selectionStorage.GetNextSelectedItem(&it, &id)) {
-				if (id < std::ssize(tableList) && id >= 0) {
-					const auto& item = tableList[id];
-					if (!item->IsDummy()) {
-						Commands::RemoveItemFromInventory(owner, tableTargetRef, item->GetEditorID(), 1);
-					}
-				}
-			}
-		}
+		auto batch = CollectSelectionBatch(1, [](const BaseObject* a_item) {
+			return a_item->GetTESForm()->IsInventoryObject();
+		});
 
-		selectionStorage.Clear();
-		UpdateActiveInventoryTables();
+		Commands::RemoveItemsFromInventory(owner, tableTargetRef, std::move(batch));
+		ClearSelection();
 	}
 
 	void UITable::AddSelectionToTargetInventory(uint32_t a_count)
@@ -355,26 +401,11 @@ namespace Modex
 		if (!tableTargetRef)
 			return;
 
-		if (GetSelectionCount() == 0) {
-			if (itemPreview && !itemPreview->IsDummy() && itemPreview->GetTESForm()->IsInventoryObject()) {
-				Commands::AddItemToRefInventory(owner, tableTargetRef, itemPreview->GetEditorID(), a_count);
-			}
-		} 
-		else {
-			void* it = NULL;
-			ImGuiID id = 0;
-
-			while (selectionStorage.GetNextSelectedItem(&it, &id)) {
-				if (id < std::ssize(tableList) && id >= 0) {
-					const auto& item = tableList[id];
-					if (item && !item->IsDummy() && item->GetTESForm()->IsInventoryObject()) {
-						Commands::AddItemToRefInventory(owner, tableTargetRef, item->GetEditorID(), a_count);
-					}
-				}
-			}
-		}
+		auto batch = CollectSelectionBatch(a_count, [](const BaseObject* a_item) {
+			return a_item->GetTESForm()->IsInventoryObject();
+		});
 
-		UpdateActiveInventoryTables();
+		Commands::AddItemsToInventory(owner, tableTargetRef, std::move(batch));
 	}
 
 	void UITable::EquipSelectionToTarget()
@@ -385,27 +416,12 @@ namespace Modex
 		if (!tableTargetRef)
 			return;
 
-		if (GetSelectionCount() == 0) {
-			if (itemPreview && !itemPreview->IsDummy() && (itemPreview->IsArmor() || itemPreview->IsWeapon())) {
-				Commands::AddAndEquipItemToInventory(owner, tableTargetRef, itemPreview->GetEditorID());
-			}
-		}
-		else {
-			void* it = NULL;
-			ImGuiID id = 0;
-
-			while (selectionStorage.GetNextSelectedItem(&it, &id)) {
-				if (id < std::ssize(tableList) && id >= 0) {
-					const auto& item = tableList[id];
-					if (item && !itemPreview->IsDummy() && (item->IsArmor() || item->IsWeapon())) {
-						Commands::AddAndEquipItemToInventory(owner, tableTargetRef, item->GetEditorID());
-					}
-				}
-			}
-		}
+		auto batch = CollectSelectionBatch(1, [](const BaseObject* a_item) {
+			return a_item->IsArmor() || a_item->IsWeapon();
+		});
 
-		selectionStorage.Clear();
-		UpdateActiveInventoryTables();
+		Commands::AddAndEquipItemsToInventory(owner, tableTargetRef, std::move(batch));
+		ClearSelection();
 	}
 
 
@@ -414,24 +430,11 @@ namespace Modex
 		if (tableList.empty()) 
 			return;
 
-		if (GetSelectionCount() == 0) {
-			if (itemPreview && !itemPreview->IsDummy()) {
-				Commands::PlaceAtMe(owner, itemPreview->GetEditorID(), a_count);
-			}
-		}
-		else {
-			void* it = NULL;
-			ImGuiID id = 0;
+		auto batch = CollectSelectionBatch(a_count, [](const BaseObject*) {
+			return true;
+		});
 
-			while (selectionStorage.GetNextSelectedItem(&it, &id)) {
-				if (id < std::ssize(tableList) && id >= 0) {
-					const auto& item = tableList[id];
-					if (item && !item->IsDummy()) {
-						Commands::PlaceAtMe(owner, item->GetEditorID(), a_count);
-					}
-				}
-			}
-		}
+		Commands::PlaceItemsAtMe(owner, std::move(batch));
 	}
 
 	bool UITable::SelectionContainsOnlyReferences()
@@ -480,7 +483,7 @@ namespace Modex
 			}
 		}
 
-		selectionStorage.Clear();
+		ClearSelection();
 	}
 
 	void UITable::BringSelectionToPlayer()
@@ -505,7 +508,7 @@ namespace Modex
 			}
 		}
 
-		selectionStorage.Clear();
+		ClearSelection();
 	}
 
 	void UITable::AddAll()
@@ -516,14 +519,19 @@ namespace Modex
 		if (!tableTargetRef)
 			return;
 		
+		std::vector<Commands::BatchItem> batch;
+		batch.reserve(tableList.size());
+
 		for (auto& item : tableList) {
 			if (item && !item->IsDummy() && item->GetTESForm()->IsInventoryObject()) {
-				Commands::AddItemToRefInventory(owner, tableTargetRef, item->GetEditorID(), 1);
+				if (auto bound = item->GetTESForm()->As<RE::TESBoundObject>()) {
+					batch.push_back({ bound, 1 });
+				}
 			}
 		}
 
-		selectionStorage.Clear();
-		UpdateActiveInventoryTables();
+		Commands::AddItemsToInventory(owner, tableTargetRef, std::move(batch));
+		ClearSelection();
 	}
 
 	void UITable::PlaceAll()
@@ -534,13 +542,19 @@ namespace Modex
 		if (!tableTargetRef)
 			return;
 
+		std::vector<Commands::BatchItem> batch;
+		batch.reserve(tableList.size());
+
 		for (auto& item : tableList) {
 			if (item && !item->IsDummy() && item->GetTESForm()->HasWorldModel()) {
-				Commands::PlaceAtMe(owner, item->GetEditorID(), 1);
+				if (auto bound = item->GetTESForm()->As<RE::TESBoundObject>()) {
+					batch.push_back({ bound, 1 });
+				}
 			}
 		}
 
-		selectionStorage.Clear();
+		Commands::PlaceItemsAtMe(owner, std::move(batch));
+		ClearSelection();
 	}
 
 	void UITable::SetDragDropTarget(DragDropHandle a_handle, UITable* a_view)
@@ -570,22 +584,88 @@ namespace Modex
 	const std::vector<std::unique_ptr<BaseObject>> UITable::GetSelection() const
 	{
 		std::vector<std::unique_ptr<BaseObject>> selectedItems;
+		selectedItems.reserve(GetSelectedItems().size());
 
-		for (auto& item : tableList) {
-			bool is_item_selected = selectionStorage.Contains(item->m_tableID);
-			if (is_item_selected) {
-				selectedItems.emplace_back(std::make_unique<BaseObject>(*item));
-			}
+		for (const auto* item : GetSelectedItems()) {
+			selectedItems.emplace_back(std::make_unique<BaseObject>(*item));
 		}
 
 		return selectedItems;
 	}
 
+	// Storage IDs are table indices (see UpdateImGuiTableIDs), and ImGuiSelectionBasicStorage
+	// iterates them in ascending order. So the index is rebuilt in O(selected) rather than
+	// O(table), and only after the selection or the table list has actually changed.
+	const std::vector<BaseObject*>& UITable::GetSelectedItems() const
+	{
+		if (!selectionDirty) {
+			return selectionCache;
+		}
+
+		selectionCache.clear();
+		selectionCache.reserve(selectionStorage.Size);
+
+		void* it = NULL;
+		ImGuiID id = 0;
+		while (selectionStorage.GetNextSelectedItem(&it, &id)) {
+			if (id < tableList.size() && tableList[id] && tableList[id]->m_tableID == id) {
+				selectionCache.push_back(tableList[id].get());
+			}
+		}
+
+		selectionDirty = false;
+		return selectionCache;
+	}
+
+	const BaseObject* UITable::GetSelectionLead() const
+	{
+		const auto& selection = GetSelectedItems();
+		return selection.empty() ? nullptr : selection.front();
+	}
+
 	uint32_t UITable::GetSelectionCount() const
 	{
 		return selectionStorage.Size;
 	}
 
+	void UITable::ClearSelection()
+	{
+		selectionStorage.Clear();
+		selectionDirty = true;
+	}
+
+	void UITable::SetItemSelected(ImGuiID a_id, bool a_selected)
+	{
+		selectionStorage.SetItemSelected(a_id, a_selected);
+		selectionDirty = true;
+	}
+
+	void UITable::ApplySelectionRequests(ImGuiMultiSelectIO* a_io)
+	{
+		if (a_io == nullptr || a_io->Requests.Size == 0) {
+			return;
+		}
+
+		selectionStorage.ApplyRequests(a_io);
+		selectionDirty = true;
+	}
+
+	// The preview is a copy so it can outlive Refresh(), but we only pay for that copy when
+	// the source row changes instead of once per drawn row.
+	void UITable::SetItemPreview(const BaseObject* a_item)
+	{
+		if (a_item == nullptr) {
+			itemPreview = nullptr;
+			previewSource = nullptr;
+			return;
+		}
+
+		if (a_item != previewSource || !itemPreview) {
+			itemPreview = std::make_unique<BaseObject>(*a_item);
+			previewSource = a_item;
+		}
+	}
+
 	// NOTE: Drag Drop specific helpers with additional inventory update callbacks.
 
 	void UITable::AddPayloadToInventory(const std::unique_ptr<BaseObject>& a_item)
@@ -696,7 +776,7 @@ namespace Modex
 			}
 		}
 
-		selectionStorage.Clear();
+		ClearSelection();
 	}
 
 	void UITable::RemovePayloadItemFromKit(const std::unique_ptr<BaseObject>& a_item)
@@ -711,6 +791,10 @@ namespace Modex
 			});
 
 		this->tableList.erase(it, this->tableList.end());
+
+		selectionDirty = true;
+		previewSource = nullptr;
+		InvalidateRowCache();
 	}
 
 	void UITable::AddSelectionToFavorites()
@@ -733,8 +817,10 @@ namespace Modex
 			}
 		}
 
+		UserData::Save();
+
 		if (tableMode == SHOWFAVORITE) {
-			Refresh();
+			RequestRefresh(RefreshReason_Favorites);
 		}
 	}
 
@@ -758,8 +844,10 @@ namespace Modex
 			}
 		}
 
+		UserData::Save();
+
 		if (tableMode == SHOWFAVORITE) {
-			Refresh();
+			RequestRefresh(RefreshReason_Favorites);
 		}
 	}
 
@@ -782,8 +870,16 @@ namespace Modex
 		}
 	}
 
+	// Outside of Refresh() (header clicks), sort and ID time goes to resortMs so it doesn't leak
+	// into the last refresh's breakdown.
 	void UITable::SortListBySpecs()
 	{
+		if (!refreshing) {
+			profile.resortMs = 0.0f;
+		}
+
+		ScopedProfileTimer timer(refreshing ? &profile.sortMs : &profile.resortMs);
+
 		std::sort(tableList.begin(), tableList.end(), [this](const std::unique_ptr<BaseObject>& a, const std::unique_ptr<BaseObject>& b) {
 			return sortSystem->SortFn(a, b);
 		});
@@ -791,14 +887,19 @@ namespace Modex
 
 	void UITable::UpdateImGuiTableIDs()
 	{
+		ScopedProfileTimer timer(refreshing ? &profile.tableIDsMs : &profile.resortMs);
+
 		for (int i = 0; i < std::ssize(tableList); i++) {
 			tableList[i]->m_tableID = i;
 		}
 
+		selectionDirty = true;
+		InvalidateRowCache();
+
 		if (!m_pendingSelection.empty()) {
 			for (auto& item : tableList) {
 				if (m_pendingSelection.contains(item->GetBaseFormID())) {
-					selectionStorage.SetItemSelected(item->m_tableID, true);
+					SetItemSelected(item->m_tableID, true);
 				}
 			}
 			m_pendingSelection.clear();
@@ -827,9 +928,88 @@ namespace Modex
 
 	void UITable::Refresh()
 	{
-		selectionStorage.Clear();
+		const auto start = ProfileClock::now();
+
+		profile.searchMs = 0.0f;
+		profile.filterMs = 0.0f;
+		profile.sortMs = 0.0f;
+		profile.tableIDsMs = 0.0f;
+		profile.rowsScanned = 0;
+		profile.rowsEmitted = 0;
+		profile.estRowAllocs = 0;
+		refreshing = true;
+
+		// A direct rebuild satisfies anything still queued.
+		pendingRefresh = RefreshReason_None;
+		pendingImmediate = false;
+		pendingRequests = 0;
+
+		ClearSelection();
 		tableList.clear();
-		
+
+		// Keep the preview copy on screen, but forget where it came from.
+		previewSource = nullptr;
+
+		RebuildTableList();
+
+		refreshing = false;
+		profile.refreshMs = ElapsedMs(start);
+		profile.refreshCount++;
+	}
+
+	// Marks the table dirty instead of rebuilding on the spot. While everything pending is
+	// debounced, each request pushes the deadline forward, so a burst of keystrokes resolves to
+	// one rebuild once it settles. A pending immediate request is never delayed by a debounce.
+	void UITable::RequestRefresh(uint32_t a_reasons, float a_debounce)
+	{
+		const double now = ImGui::GetCurrentContext() ? ImGui::GetTime() : 0.0;
+		const double deadline = now + (std::max)(a_debounce, 0.0f);
+
+		if (pendingRefresh == RefreshReason_None) {
+			refreshDeadline = deadline;
+		} else if (a_debounce > 0.0f && !pendingImmediate) {
+			refreshDeadline = (std::max)(refreshDeadline, deadline);
+		} else {
+			refreshDeadline = (std::min)(refreshDeadline, deadline);
+		}
+
+		pendingImmediate |= a_debounce <= 0.0f;
+
+		pendingRefresh |= a_reasons;
+		pendingRequests++;
+	}
+
+	// Runs at most one Refresh() for everything requested since the last flush. Called from the
+	// top of Draw(), so a rebuild always lands before the rows it affects are drawn.
+	void UITable::FlushRefresh()
+	{
+		if (pendingRefresh == RefreshReason_None) {
+			return;
+		}
+
+		if (ImGui::GetCurrentContext() && ImGui::GetTime() < refreshDeadline) {
+			return;
+		}
+
+		profile.lastReasons = pendingRefresh;
+		profile.refreshRequests = pendingRequests;
+
+		Refresh();
+	}
+
+	void UITable::EmitRow(TableItem&& a_item)
+	{
+		const size_t capacity = tableList.capacity();
+		tableList.emplace_back(std::move(a_item));
+
+		// An estimate: one allocation for the row itself, plus one whenever the list had to grow.
+		// Allocations inside BaseObject aren't seen here.
+		profile.rowsEmitted++;
+		profile.estRowAllocs += tableList.capacity() != capacity ? 2 : 1;
+	}
+
+	void UITable::RebuildTableList()
+	{
 		if (this->tableMode == SHOWRECENT) {
 			return FilterRecentImpl();
 		}
@@ -863,7 +1043,7 @@ namespace Modex
 	
 	void UITable::FilterFavoriteImpl()
 	{
-		const auto favorites = UserData::GetFavoritesAsVector();
+		const auto& favorites = UserData::GetFavoriteItems();
 		auto temp = TableList{};
 
 		for (const auto& favoriteItem : favorites) {
@@ -885,6 +1065,8 @@ namespace Modex
 		}
 
 		for (auto& item : temp) {
+			profile.rowsScanned++;
+
 			if (item->GetOwnership() != owner) {
 				continue;
 			}
@@ -893,7 +1075,7 @@ namespace Modex
 				continue;
 			}
 
-			this->tableList.emplace_back(std::move(item)); 
+			EmitRow(std::move(item));
 		}
 
 		SortListBySpecs();
@@ -902,7 +1084,7 @@ namespace Modex
 
 	void UITable::FilterRecentImpl()
 	{
-		const auto recent = UserData::GetRecentAsVector();
+		const auto& recent = UserData::GetRecentItems();
 		auto temp = TableList{};
 
 		for (const auto& recentItem : recent) {
@@ -924,6 +1106,8 @@ namespace Modex
 		}
 
 		for (auto& item : temp) {
+			profile.rowsScanned++;
+
 			if (item->GetOwnership() != owner) {
 				continue;
 			}
@@ -932,7 +1116,7 @@ namespace Modex
 				continue;
 			}
 
-			this->tableList.emplace_back(std::move(item)); 
+			EmitRow(std::move(item));
 		}
 
 		SortListBySpecs();
@@ -947,12 +1131,13 @@ namespace Modex
 		const auto& kit = selectedKitPtr->m_items;
 
 		for (const auto& item : kit) {
-			RE::TESForm* form = RE::TESForm::LookupByEditorID(item->m_editorid);
+			profile.rowsScanned++;
+			RE::TESForm* form = item.GetForm();
 
 			if (form) {
-				tableList.emplace_back(std::make_unique<BaseObject>(form, owner, 0, 0, item->m_amount, item->m_equipped));
+				EmitRow(std::make_unique<BaseObject>(form, owner, 0, 0, item.m_amount, item.m_equipped));
 			} else {
-				tableList.emplace_back(std::make_unique<BaseObject>(item->m_name, item->m_editorid, item->m_plugin, owner, 0, item->m_amount, item->m_equipped));
+				EmitRow(std::make_unique<BaseObject>(std::string(item.GetName()), std::string(item.GetEditorID()), std::string(item.GetPlugin()), owner, 0, item.m_amount, item.m_equipped));
 			}
 		}
 
@@ -965,7 +1150,8 @@ namespace Modex
 		const auto inventory = GetReferenceInventory();
 
 		for (const auto& item : inventory) {
-			this->tableList.emplace_back(std::make_unique<BaseObject>(item.GetTESForm(), owner, 0, 0, item.GetQuantity()));
+			profile.rowsScanned++;
+			EmitRow(std::make_unique<BaseObject>(item.GetTESForm(), owner, 0, 0, item.GetQuantity()));
 		}
 
 		SortListBySpecs();
@@ -978,35 +1164,51 @@ namespace Modex
 			return;
 		}
 
+		// Per-row timers are only armed while the profiler panel is open.
+		float* search_timer = show_profiler ? &profile.searchMs : nullptr;
+		float* filter_timer = show_profiler ? &profile.filterMs : nullptr;
+
+		// Resolved once per pass; the blacklist is only consulted when every plugin is shown.
+		const bool showAll = this->selectedPlugin == Translate("SHOWALL");
+		const auto* blacklist = BlacklistConfig::GetSingleton();
+		const auto filter = filterSystem ? filterSystem->CompileFilter() : CompiledFilter();
+
 		for (const auto& item : a_data) {
-			if (searchSystem->CompareInputToObject(&item) == false) {
-				continue;
+			profile.rowsScanned++;
+
+			bool matched = false;
+			{
+				ScopedProfileTimer timer(search_timer);
+				matched = searchSystem->CompareInputToObject(&item);
 			}
 
-			// All Mods vs Selected Mod
-			if (this->selectedPlugin != Translate("SHOWALL") && item.GetPluginName() != this->selectedPlugin) {
+			if (!matched) {
 				continue;
 			}
 
-			// Blacklist
-			if (this->selectedPlugin == Translate("SHOWALL")) {
-				if (const auto& fileOpt = item.GetFile(); fileOpt.has_value()) {
-					const auto& file = fileOpt.value();
-					if (BlacklistConfig::GetSingleton()->Has(file)) {
-						continue;
-					}
+			{
+				ScopedProfileTimer timer(filter_timer);
+
+				// All Mods vs Selected Mod
+				if (!showAll && item.GetPluginName() != this->selectedPlugin) {
+					continue;
 				}
-			}
 
-			// Filter Tree Node system
-			if (filterSystem && !filterSystem->ShouldShowItem(&item)) {
-				continue;
+				// Blacklist
+				if (showAll && blacklist->Has(item.GetFileIndex())) {
+					continue;
+				}
+
+				// Filter Tree Node system
+				if (!filter.Matches(&item)) {
+					continue;
+				}
 			}
 
 			if (item.IsDummy()) {
-				this->tableList.emplace_back(std::make_unique<BaseObject>(item));
+				EmitRow(std::make_unique<BaseObject>(item));
 			} else {
-				this->tableList.emplace_back(std::make_unique<BaseObject>(item.GetTESForm(), owner, 0, item.m_refID));
+				EmitRow(std::make_unique<BaseObject>(item.GetTESForm(), owner, 0, item.m_refID));
 			}
 		}
 
@@ -1035,15 +1237,15 @@ namespace Modex
 		int current_idx = searchSystem->GetSearchKeyIndex();
 		const std::string current_key_text = searchSystem->GetCurrentKeyString();
 
-		ImGui::PushStyleColor(ImGuiCol_FrameBg, ThemeConfig::GetColor("BG_LIGHT"));
-		ImGui::PushStyleColor(ImGuiCol_FrameBgHovered, ThemeConfig::GetHover("BG_LIGHT"));
-		ImGui::PushStyleColor(ImGuiCol_FrameBgActive, ThemeConfig::GetActive("BG_LIGHT"));
+		ImGui::PushStyleColor(ImGuiCol_FrameBg, ThemeConfig::GetColor(ThemeColor::BgLight));
+		ImGui::PushStyleColor(ImGuiCol_FrameBgHovered, ThemeConfig::GetHover(ThemeColor::BgLight));
+		ImGui::PushStyleColor(ImGuiCol_FrameBgActive, ThemeConfig::GetActive(ThemeColor::BgLight));
 		ImGui::PushStyleVar(ImGuiStyleVar_SelectableTextAlign, ImVec2(0.5f, 0.5f));
 
 		const std::vector<std::string> available_keys = searchSystem->GetAvailableKeysVector();
 		if (UICustom::FancyDropdown("##Search::Input::Key", "TABLE_KEY_TOOLTIP", current_idx, available_keys, key_width)) {
 			searchSystem->SetSearchKeyByIndex(current_idx);
-			Refresh();
+			RequestRefresh(RefreshReason_Search);
 		}
 
 		ImGui::PopStyleVar();
@@ -1056,12 +1258,13 @@ namespace Modex
 		const bool force_quick = HasFlag(ModexTableFlag_APIMode) ? true : useQuickSearch;
 		const auto input_flags = force_quick ? ImGuiInputTextFlags_AutoSelectAll :
 		ImGuiInputTextFlags_AutoSelectAll | ImGuiInputTextFlags_EnterReturnsTrue;
-		const std::string& search_hint = TRUNCATE(Translate("TABLE_SEARCH_HINT"), input_width * 0.80f).c_str();
+		const std::string& search_hint = TRUNCATE(Translate("TABLE_SEARCH_HINT"), input_width * 0.80f);
 
 		static bool key_hovered;
-		ImGui::PushStyleColor(ImGuiCol_FrameBg, key_hovered ? ThemeConfig::GetHover("BG_LIGHT") : ThemeConfig::GetColor("BG_LIGHT"));
+		ImGui::PushStyleColor(ImGuiCol_FrameBg, key_hovered ? ThemeConfig::GetHover(ThemeColor::BgLight) : ThemeConfig::GetColor(ThemeColor::BgLight));
 		if (UICustom::FancyInputText("##Search::Input::Compare", search_hint.c_str(), "TABLE_SEARCH_TOOLTIP", searchSystem->GetSearchBuffer(), input_width, input_flags)) {
-			this->Refresh();
+			// Quick search fires per keystroke, so wait for typing to settle before rebuilding.
+			this->RequestRefresh(RefreshReason_Search, force_quick ? SEARCH_DEBOUNCE : 0.0f);
 		}
 		ImGui::PopStyleColor();
 
@@ -1087,14 +1290,14 @@ namespace Modex
 		if (tableMode != SHOWALL) ImGui::BeginDisabled();
 
 		static bool hovered;
-		ImGui::PushStyleColor(ImGuiCol_FrameBg, hovered ? ThemeConfig::GetHover("BG_LIGHT") : ThemeConfig::GetColor("BG_LIGHT"));
+		ImGui::PushStyleColor(ImGuiCol_FrameBg, hovered ? ThemeConfig::GetHover(ThemeColor::BgLight) : ThemeConfig::GetColor(ThemeColor::BgLight));
 
 		if (searchSystem->InputTextComboBox("##Search::Filter::PluginField", pluginSearchBuffer, selectedPlugin, IM_ARRAYSIZE(pluginSearchBuffer), pluginList, a_size.x)) {
 			this->selectedPlugin = this->pluginSearchBuffer;
 			this->pluginSearchBuffer[0] = '\0';
 			
-			this->selectionStorage.Clear();
-			this->Refresh();
+			this->ClearSelection();
+			this->RequestRefresh(RefreshReason_Plugin);
 		}
 
 		hovered = ImGui::IsItemHovered();
@@ -1119,17 +1322,17 @@ namespace Modex
 		useQuickSearch = UserData::Get<bool>("Modex::Table::UseQuickSearch", false);
 
 		colors.alpha = ImGui::GetStyle().Alpha;
-		colors.background = ThemeConfig::GetColorU32("TABLE_BG", colors.alpha);
-		colors.backgroundAlt = ThemeConfig::GetColorU32("TABLE_BG_ALT", colors.alpha);
-		colors.selected = ThemeConfig::GetColorU32("TABLE_SELECTED", colors.alpha);
-		colors.outline = ThemeConfig::GetColorU32("TABLE_BORDER", colors.alpha);
-		colors.hover = ThemeConfig::GetColorU32("TABLE_HOVER", colors.alpha);
-		colors.text = ThemeConfig::GetColorU32("TEXT", colors.alpha);
-		colors.textEnchanted = ThemeConfig::GetColorU32("TEXT_ENCHANTED", colors.alpha);
-		colors.textUnique = ThemeConfig::GetColorU32("TEXT_UNIQUE", colors.alpha);
-		colors.textEssential = ThemeConfig::GetColorU32("TEXT_ESSENTIAL", colors.alpha);
-		colors.textUniqueEssential = ThemeConfig::GetColorU32("TEXT_UNIQUE_ESSENTIAL", colors.alpha);
-		colors.error = ThemeConfig::GetColorU32("ERROR", colors.alpha * 0.1f);
+		colors.background = ThemeConfig::GetColorU32(ThemeColor::TableBg, colors.alpha);
+		colors.backgroundAlt = ThemeConfig::GetColorU32(ThemeColor::TableBgAlt, colors.alpha);
+		colors.selected = ThemeConfig::GetColorU32(ThemeColor::TableSelected, colors.alpha);
+		colors.outline = ThemeConfig::GetColorU32(ThemeColor::TableBorder, colors.alpha);
+		colors.hover = ThemeConfig::GetColorU32(ThemeColor::TableHover, colors.alpha);
+		colors.text = ThemeConfig::GetColorU32(ThemeColor::Text, colors.alpha);
+		colors.textEnchanted = ThemeConfig::GetColorU32(ThemeColor::TextEnchanted, colors.alpha);
+		colors.textUnique = ThemeConfig::GetColorU32(ThemeColor::TextUnique, colors.alpha);
+		colors.textEssential = ThemeConfig::GetColorU32(ThemeColor::TextEssential, colors.alpha);
+		colors.textUniqueEssential = ThemeConfig::GetColorU32(ThemeColor::TextUniqueEssential, colors.alpha);
+		colors.error = ThemeConfig::GetColorU32(ThemeColor::Error, colors.alpha * 0.1f);
 
 		if (styleFontSize == 0.0f) {
 			styleFontSize = static_cast<decltype(styleFontSize)>(config.globalFontSize);
@@ -1174,18 +1377,18 @@ namespace Modex
 
 	void UITable::DrawModeDropdown(const ImVec2& a_size)
 	{
-		ImGui::PushStyleColor(ImGuiCol_FrameBg, ThemeConfig::GetColor("BG_LIGHT"));
-		ImGui::PushStyleColor(ImGuiCol_FrameBgHovered, ThemeConfig::GetHover("BG_LIGHT"));
-		ImGui::PushStyleColor(ImGuiCol_FrameBgActive, ThemeConfig::GetActive("BG_LIGHT"));
+		ImGui::PushStyleColor(ImGuiCol_FrameBg, ThemeConfig::GetColor(ThemeColor::BgLight));
+		ImGui::PushStyleColor(ImGuiCol_FrameBgHovered, ThemeConfig::GetHover(ThemeColor::BgLight));
+		ImGui::PushStyleColor(ImGuiCol_FrameBgActive, ThemeConfig::GetActive(ThemeColor::BgLight));
 		ImGui::PushStyleVar(ImGuiStyleVar_SelectableTextAlign, ImVec2(0.5f, 0.5f));
 
 		auto modes = magic_enum::enum_names<TableMode>();
 		const std::vector<std::string> mode_strings(modes.begin(), modes.end());
 		int current_idx = static_cast<int>(tableMode);
 		if (UICustom::FancyDropdown("##Search::Input::Mode", "TABLE_MODE_TOOLTIP", current_idx, mode_strings, a_size.x)) {
-			selectionStorage.Clear();
+			ClearSelection();
 			tableMode = current_idx;
-			Refresh();
+			RequestRefresh(RefreshReason_Mode);
 		}
 
 		ImGui::PopStyleColor(3);
@@ -1227,10 +1430,10 @@ namespace Modex
 
 		// Outline & Background
 		const float global_alpha = ImGui::GetStyle().Alpha;
-		const ImU32 bg_color = ThemeConfig::GetColorU32("BG", global_alpha);
-		const ImU32 bg_color_alt = ThemeConfig::GetColorU32("BG_LIGHT", global_alpha);
-		const ImU32 outline_color = ThemeConfig::GetColorU32("BG", global_alpha);
-		const ImU32 text_color = ThemeConfig::GetColorU32("TEXT", global_alpha);
+		const ImU32 bg_color = ThemeConfig::GetColorU32(ThemeColor::Bg, global_alpha);
+		const ImU32 bg_color_alt = ThemeConfig::GetColorU32(ThemeColor::BgLight, global_alpha);
+		const ImU32 outline_color = ThemeConfig::GetColorU32(ThemeColor::Bg, global_alpha);
+		const ImU32 text_color = ThemeConfig::GetColorU32(ThemeColor::Text, global_alpha);
 
 		// Background
 		if (a_kit.m_tableID % 2 == 0) {
@@ -1311,15 +1514,15 @@ namespace Modex
 
 		if (destination->GetDragDropHandle() == DragDropHandle::Kit) {
 			destination->SyncChangesToKit();
-			destination->Refresh();
+			destination->RequestRefresh(RefreshReason_Kit);
 		}
 
 		if (origin->GetDragDropHandle() == DragDropHandle::Kit) {
 			origin->SyncChangesToKit();
-			origin->Refresh();
+			origin->RequestRefresh(RefreshReason_Kit);
 		}
 
-		Refresh();
+		RequestRefresh(RefreshReason_Kit | RefreshReason_Inventory);
 	}
 
 	void UITable::HandleDragDropBehavior()
@@ -1404,11 +1607,11 @@ namespace Modex
 						const ImVec2 icon_size = ImGui::CalcTextSize(tooltip_icon.c_str());
 						ImGui::PopFont();
 
-						DrawList->AddRectFilled(min, max, ThemeConfig::GetColorU32("BG"));
+						DrawList->AddRectFilled(min, max, ThemeConfig::GetColorU32(ThemeColor::Bg));
 
 						DrawList->AddText(ImGui::GetFont(), font_size,
 							min + (table_size / 2.0f) - (icon_size / 1.5f) - ImVec2(0, center_offset),
-							ThemeConfig::GetColorU32("TEXT"),
+							ThemeConfig::GetColorU32(ThemeColor::Text),
 							tooltip_icon.c_str()
 						);
 
@@ -1418,7 +1621,7 @@ namespace Modex
 
 						DrawList->AddText(ImGui::GetFont(), font_size / 2.0f,
 							min + (table_size / 2.0f) - (string_size / 2.0f) + ImVec2(0, icon_size.y / 1.5f) - ImVec2(0, center_offset),
-							ThemeConfig::GetColorU32("TEXT", 0.75f),
+							ThemeConfig::GetColorU32(ThemeColor::Text, 0.75f),
 							tooltip_string.c_str()
 						);
 
@@ -1429,7 +1632,7 @@ namespace Modex
 
 							DrawList->AddText(ImGui::GetFont(), font_size / 2.5f,
 								min + (table_size / 2.0f) - (target_size / 2.0f) + ImVec2(0, icon_size.y * 1.25f) - ImVec2(0, center_offset),
-								ThemeConfig::GetColorU32("TEXT", 0.5f),
+								ThemeConfig::GetColorU32(ThemeColor::Text, 0.5f),
 								tooltip_target.c_str()
 							);
 						}
@@ -1469,7 +1672,7 @@ namespace Modex
 
 										for (const auto& item : *items) {
 											pointer->m_items.emplace_back(EquipmentConfig::CreateKitItem(*item));
-											destination->Refresh();
+											destination->RequestRefresh(RefreshReason_Kit);
 										}
 									}
 								}
@@ -1499,7 +1702,7 @@ namespace Modex
 
 	void UITable::HandleItemHoverPreview(const std::unique_ptr<BaseObject>& a_item)
 	{
-		itemPreview = std::make_unique<BaseObject>(*a_item);
+		SetItemPreview(a_item.get());
 
 		if (HasFlag(ModexTableFlag_EnableItemPreviewOnHover) && !a_item->IsDummy()) {
 			if (ImGui::IsItemHovered(ImGuiHoveredFlags_DelayShort | ImGuiHoveredFlags_NoSharedDelay)) {
@@ -1569,7 +1772,7 @@ namespace Modex
 		if (HasFlag(ModexTableFlag_APIMode)) {
 			if (ImGui::IsItemClicked(ImGuiMouseButton_Right)) {
 				if (!selectionStorage.Contains(a_item->m_tableID)) {
-					selectionStorage.Clear();
+					ClearSelection();
 				}
 
 				if (!a_item->IsDummy()) {
@@ -1609,7 +1812,7 @@ namespace Modex
 
 		if (ImGui::IsItemClicked(ImGuiMouseButton_Right)) {
 			if (!selectionStorage.Contains(a_item->m_tableID)) {
-				selectionStorage.Clear();
+				ClearSelection();
 			}
 
 			if (!a_item->IsDummy() && owner != Ownership::Cell) {
@@ -1621,12 +1824,12 @@ namespace Modex
 			const bool shift_down = ImGui::GetIO().KeyShift;
 			
 			if (!tableTargetRef || !IsValidTargetReference()) {
-				ImGui::TextColored(ThemeConfig::GetColor("ERROR"), "%s", Translate("ERROR_INVALID_REFERENCE"));
+				ImGui::TextColored(ThemeConfig::GetColor(ThemeColor::Error), "%s", Translate("ERROR_INVALID_REFERENCE"));
 				ImGui::EndPopup();
 				return;
 			}
 
-			const auto color = tableTargetRef->IsPlayerRef() ? ThemeConfig::GetColor("SUCCESS") : ThemeConfig::GetColor("WARN");
+			const auto color = tableTargetRef->IsPlayerRef() ? ThemeConfig::GetColor(ThemeColor::Success) : ThemeConfig::GetColor(ThemeColor::Warn);
 			ImGui::TextColored(color, "%s %s", ICON_LC_ASTERISK " ", tableTargetRef->GetName());
 			ImGui::SeparatorEx(ImGuiSeparatorFlags_Horizontal);
 
@@ -1826,8 +2029,8 @@ namespace Modex
 	void UITable::HandleKeyboardNavigation(const TableList& a_tableList)
 	{
 		if (ImGui::Shortcut(ImGuiKey_Escape, ImGuiInputFlags_RouteFromRootWindow)) {
-			selectionStorage.Clear();
-			itemPreview = nullptr;
+			ClearSelection();
+			SetItemPreview(nullptr);
 			return;
 		}
 
@@ -1850,16 +2053,25 @@ namespace Modex
 		// HACK: This is a result of IMenu impl key behavior. Could do ControlMap fixes, but nty.
 		if (ImGui::Shortcut(ImGuiMod_Ctrl | ImGuiKey_LeftArrow, ImGuiInputFlags_RouteFromRootWindow)) {
 			if (selectionStorage.Size > 0) {
-				selectionStorage.Clear();
+				ClearSelection();
 			} else {
 				for (auto& item : a_tableList) {
 					if (item != nullptr) {
-						selectionStorage.SetItemSelected(item->m_tableID, true);
+						SetItemSelected(item->m_tableID, true);
 					}
 				}
 			}
 		}
 
+		if (ImGui::Shortcut(ImGuiMod_Ctrl | ImGuiKey_Z, ImGuiInputFlags_RouteFromRootWindow)) {
+			CommandJournal::GetSingleton()->Undo();
+		}
+
+		if (ImGui::Shortcut(ImGuiMod_Ctrl | ImGuiKey_Y, ImGuiInputFlags_RouteFromRootWindow) ||
+			ImGui::Shortcut(ImGuiMod_Ctrl | ImGuiMod_Shift | ImGuiKey_Z, ImGuiInputFlags_RouteFromRootWindow)) {
+			CommandJournal::GetSingleton()->Redo();
+		}
+
 		if (ImGui::Shortcut(ImGuiKey_F, ImGuiInputFlags_RouteFromRootWindow)) {
 			if (selectionStorage.Size > 0) {
 				void* it = NULL;
@@ -1881,8 +2093,10 @@ namespace Modex
 				}
 			}
 
+			UserData::Save();
+
 			if (tableMode == SHOWFAVORITE) {
-				Refresh();
+				RequestRefresh(RefreshReason_Favorites);
 			}
 		}
 
@@ -1897,17 +2111,17 @@ namespace Modex
 
 				if (current_index + 1 < a_tableList.size() && a_tableList[current_index + 1]) {
 					if (!ImGui::IsKeyDown(ImGuiMod_Shift)) {
-						selectionStorage.Clear();
+						ClearSelection();
 					}
 
 					navPositionID = a_tableList[current_index + 1]->m_tableID;
 					bool is_previously_selected = selectionStorage.Contains(navPositionID);
-					selectionStorage.SetItemSelected(navPositionID, true);
-					itemPreview = std::make_unique<BaseObject>(*a_tableList[navPositionID]);
+					SetItemSelected(navPositionID, true);
+					SetItemPreview(a_tableList[navPositionID].get());
 					updateKeyboardNav = true;
 
 					if (is_previously_selected) {
-						selectionStorage.SetItemSelected(navPositionID - 1, false);
+						SetItemSelected(navPositionID - 1, false);
 					}
 
 					// itemPreview = std::make_unique<BaseObject>(*a_tableList[current_index + 1]);
@@ -1929,16 +2143,16 @@ namespace Modex
 					navPositionID = a_tableList[current_index - 1]->m_tableID;
 
 					if (!ImGui::IsKeyDown(ImGuiMod_Shift)) {
-						selectionStorage.Clear();
+						ClearSelection();
 					}
 					
 					bool is_previously_selected = selectionStorage.Contains(navPositionID);
-					selectionStorage.SetItemSelected(navPositionID, true);
-					itemPreview = std::make_unique<BaseObject>(*a_tableList[navPositionID]);
+					SetItemSelected(navPositionID, true);
+					SetItemPreview(a_tableList[navPositionID].get());
 					updateKeyboardNav = true;
 
 					if (is_previously_selected) {
-						selectionStorage.SetItemSelected(navPositionID + 1, false);
+						SetItemSelected(navPositionID + 1, false);
 					}
 
 					// itemPreview = std::make_unique<BaseObject>(*a_tableList[current_index - 1]);
@@ -1947,6 +2161,43 @@ namespace Modex
 		}
 	}
 
+	// Drops every cached row when anything that feeds the label layout changes. Called once per
+	// frame from Draw() after the table font has been pushed.
+	void UITable::ValidateRowCache()
+	{
+		RowCacheKey key;
+		key.font = ImGui::GetFont();
+		key.fontSize = ImGui::GetFontSize();
+		key.columnWidth = LayoutColumnWidth;
+		key.itemWidth = LayoutItemSize.x;
+		key.sortProperty = sortSystem ? sortSystem->GetSecondarySortFilter().GetPropertyType() : PropertyType::kNone;
+		key.showEditorID = showEditorID;
+		key.showFormID = showFormID;
+		key.showItemIcon = showItemIcon;
+
+		if (!(key == rowCacheKey)) {
+			rowCacheKey = key;
+			InvalidateRowCache();
+		}
+	}
+
+	UITable::RowCache& UITable::AcquireRowCache(const BaseObject* a_item, bool& a_rebuild)
+	{
+		if (a_item->m_tableID >= rowCache.size()) {
+			rowCache.resize(std::max<size_t>(a_item->m_tableID + 1, tableList.size()));
+		}
+
+		RowCache& cache = rowCache[a_item->m_tableID];
+		a_rebuild = cache.source != a_item || cache.quantity != a_item->GetQuantity();
+
+		if (a_rebuild) {
+			cache.source = a_item;
+			cache.quantity = a_item->GetQuantity();
+		}
+
+		return cache;
+	}
+
 	void UITable::DrawKitItem(const std::unique_ptr<BaseObject>& a_item, const ImVec2& a_pos, bool a_selected)
 	{
 		const auto& draw_list = ImGui::GetWindowDrawList();
@@ -2003,14 +2254,21 @@ namespace Modex
 		const float left_align = bb.Min.x + LayoutOuterPadding;
 		const ImVec2 center_left_align = ImVec2(left_align, center_align);
 
-		// Dynamically concenate quantity to string.
-		const std::string quantity_string = a_item->GetQuantity() > 1 ? std::format(" ({})", std::to_string(a_item->GetQuantity())) : "";
-		const float quantity_offset = ImGui::CalcTextSize(quantity_string.c_str()).x;
+		bool rebuild = false;
+		RowCache& cache = AcquireRowCache(a_item.get(), rebuild);
+
+		if (rebuild) {
+			// Dynamically concenate quantity to string.
+			const std::string quantity_string = a_item->GetQuantity() > 1 ? std::format(" ({})", a_item->GetQuantity()) : "";
+			const float quantity_offset = ImGui::CalcTextSize(quantity_string.c_str()).x;
+
+			// Resolve item naming string based on editorid, icon, and truncation.
+			const std::string item_icon = showItemIcon ? a_item->GetItemIcon() + " " : "";
+			const std::string& raw_name = showEditorID ? a_item->GetEditorID() : a_item->GetName();
+			cache.name = TRUNCATE(item_icon + raw_name, (spacing * 1.75f) - quantity_offset) + quantity_string;
+		}
 
-		// Resolve item naming string based on editorid, icon, and truncation.
-		const std::string item_icon = showItemIcon ? (a_item->GetItemIcon() + " ").c_str() : "";
-		const std::string raw_name = showEditorID ? a_item->GetEditorID() : a_item->GetName();
-		const std::string name_string = TRUNCATE(item_icon + raw_name, (spacing * 1.75f) - quantity_offset) + quantity_string;
+		const std::string& name_string = cache.name;
 
 		bool is_enchanted = false;
 		if (auto weapon = a_item->GetTESWeapon()) {
@@ -2039,7 +2297,7 @@ namespace Modex
 		ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0.0f, 0.0f));
 
 		if (a_item->GetFormType() == RE::FormType::Armor || a_item->GetFormType() == RE::FormType::Weapon) {
-			const auto equip_color = a_item->GetEquipped() ? ThemeConfig::GetColor("PRIMARY") : ThemeConfig::GetColor("PRIMARY", 0.5f);
+			const auto equip_color = a_item->GetEquipped() ? ThemeConfig::GetColor(ThemeColor::Primary) : ThemeConfig::GetColor(ThemeColor::Primary, 0.5f);
 
 			ImGui::PushStyleColor(ImGuiCol_Button, equip_color);
 			const auto text = a_item->GetFormType() == RE::FormType::Armor ? a_item->GetArmorSlots()[0] : a_item->GetWeaponType();
@@ -2050,8 +2308,8 @@ namespace Modex
 			ImGui::PopStyleColor();
 		} else {
 			const auto form_type_text = RE::FormTypeToString(a_item->GetFormType());
-			ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ThemeConfig::GetColor("PRIMARY"));
-			ImGui::PushStyleColor(ImGuiCol_ButtonActive, ThemeConfig::GetColor("PRIMARY"));
+			ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ThemeConfig::GetColor(ThemeColor::Primary));
+			ImGui::PushStyleColor(ImGuiCol_ButtonActive, ThemeConfig::GetColor(ThemeColor::Primary));
 			ImGui::Button(form_type_text.data(), equip_size);
 			ImGui::PopStyleColor(2);
 		}
@@ -2130,13 +2388,30 @@ namespace Modex
 		const ImVec2 center_left_align = ImVec2(left_align, center_align);
 		const ImVec2 center_right_align = ImVec2(right_align, center_align);
 
-		// Name string construction with dynamic truncation based on available space.
-		const std::string quantity_string = a_item->GetQuantity() > 1 ? std::format(" ({})", std::to_string(a_item->GetQuantity())) : "";
-		const std::string item_icon = showItemIcon ? (a_item->GetItemIcon() + " ").c_str() : "";
-		const float quantity_offset = ImGui::CalcTextSize(quantity_string.c_str()).x;
+		const PropertyType& sort_property = this->sortSystem->GetSecondarySortFilter().GetPropertyType();
+		const bool show_sort_text = sort_property != PropertyType::kPlugin and sort_property != PropertyType::kName and sort_property != PropertyType::kGoldValue;
+
+		bool rebuild = false;
+		RowCache& cache = AcquireRowCache(a_item.get(), rebuild);
+
+		if (rebuild) {
+			// Name string construction with dynamic truncation based on available space.
+			const std::string quantity_string = a_item->GetQuantity() > 1 ? std::format(" ({})", a_item->GetQuantity()) : "";
+			const std::string item_icon = showItemIcon ? a_item->GetItemIcon() + " " : "";
+			const float quantity_offset = ImGui::CalcTextSize(quantity_string.c_str()).x;
+
+			const std::string& raw_name = showEditorID ? a_item->GetEditorID() : a_item->GetName();
+			cache.name = TRUNCATE(item_icon + raw_name, (spacing * 1.5f) - padding - quantity_offset) + quantity_string;
+			cache.nameWidth = ImGui::CalcTextSize(cache.name.c_str()).x;
+			cache.plugin = showFormID ? a_item->GetFormID() : TRUNCATE(a_item->GetPluginName(), spacing - padding);
+
+			if (show_sort_text) {
+				cache.sortText = TRUNCATE(a_item->GetPropertyValueWithIcon(sort_property), spacing * 0.75f);
+				cache.sortWidth = ImGui::CalcTextSize(cache.sortText.c_str()).x;
+			}
+		}
 
-		const std::string raw_name = showEditorID ? a_item->GetEditorID() : a_item->GetName();
-		const std::string name_string = TRUNCATE(item_icon + raw_name, (spacing * 1.5f) - padding - quantity_offset) + quantity_string;
+		const std::string& name_string = cache.name;
 
 		const bool is_favorited = a_item->m_refID == 0 ? UserData::IsFavorited(a_item->GetEditorID()) : UserData::IsFavorited(a_item->m_refID);
 		const ImVec2 favorite_pos = ImVec2(center_right_align.x - ImGui::GetFontSize(), center_right_align.y);
@@ -2175,21 +2450,18 @@ namespace Modex
 			}
 		}
 
-		const PropertyType& sort_property = this->sortSystem->GetSecondarySortFilter().GetPropertyType();
 		const ImVec2 sort_pos = ImVec2(bb.Min.x + spacing * 2.5f, center_align);
 		const float sort_text_cutoff = spacing * 1.5f;
 
 		if (const auto& item = a_item; item->IsItem()) {
 			if (auto armor = item->GetTESArmor()) {
 				{
-					const std::string rating_string = item->GetPropertyValueWithIcon(PropertyType::kArmorRating);
-					const std::string type_string = TRUNCATE(item->GetPropertyValueWithIcon(PropertyType::kArmorType), sort_text_cutoff);
-
 					if (armor->formEnchanting != nullptr) {
 						text_color = colors.textEnchanted;
 					}
 
 					if (sort_property == PropertyType::kNone) {
+						const std::string rating_string = item->GetPropertyValueWithIcon(PropertyType::kArmorRating);
 						draw_list->AddText(sort_pos, colors.text, rating_string.c_str());
 						if (IsMouseHoveringRect(sort_pos, ImVec2(sort_pos.x + font_size, sort_pos.y + font_size))) {
 							UINotification::ShowPropertyTooltip(PropertyType::kArmorRating);
@@ -2228,15 +2500,12 @@ namespace Modex
 
 			if (auto weapon = item->GetTESWeapon()) {
 				{
-					const std::string damage_string = item->GetPropertyValueWithIcon(PropertyType::kWeaponDamage);
-					const std::string skill_string = TRUNCATE(item->GetPropertyValueWithIcon(PropertyType::kWeaponSkill), sort_text_cutoff);
-					// const std::string type_string = item.GetPropertyValueWithIcon(PropertyType::kWeaponType);
-
 					if (weapon->formEnchanting != nullptr) {
 						text_color = colors.textEnchanted;
 					}
 					
 					if (sort_property == PropertyType::kNone) {
+						const std::string damage_string = item->GetPropertyValueWithIcon(PropertyType::kWeaponDamage);
 						draw_list->AddText(sort_pos, colors.text, damage_string.c_str());
 						if (IsMouseHoveringRect(sort_pos, ImVec2(sort_pos.x + font_size, sort_pos.y + font_size))) {
 							UINotification::ShowPropertyTooltip(PropertyType::kWeaponDamage);
@@ -2246,8 +2515,7 @@ namespace Modex
 			}
 		}
 
-		const std::string plugin_name = showFormID ? a_item->GetFormID() : TRUNCATE(a_item->GetPluginName(), spacing - padding);
-		draw_list->AddText(center_left_align, colors.text, plugin_name.c_str());
+		draw_list->AddText(center_left_align, colors.text, cache.plugin.c_str());
 
 		const ImVec2 name_pos = ImVec2(bb.Min.x + spacing - 5.0f, center_align);
 		draw_list->AddText(name_pos, text_color, name_string.c_str());
@@ -2257,7 +2525,7 @@ namespace Modex
 		}
 
 		// Display tooltips relevant to name colors (essential, unique, enchanted)
-		if (IsMouseHoveringRect(name_pos + ImVec2(font_size, 0.0f), ImVec2(name_pos.x + ImGui::CalcTextSize(name_string.c_str()).x, name_pos.y + font_size))) {
+		if (IsMouseHoveringRect(name_pos + ImVec2(font_size, 0.0f), ImVec2(name_pos.x + cache.nameWidth, name_pos.y + font_size))) {
 			if (a_item->IsEssential() && !a_item->IsUnique()) {
 				UINotification::ShowPropertyTooltip(PropertyType::kEssential);
 			} else if (a_item->IsUnique() && !a_item->IsEssential()) {
@@ -2269,11 +2537,10 @@ namespace Modex
 			}
 		}
 
-		if (sort_property != PropertyType::kPlugin and sort_property != PropertyType::kName and sort_property != PropertyType::kGoldValue) {
-			const std::string sort_text = TRUNCATE(a_item->GetPropertyValueWithIcon(sort_property), spacing * 0.75f);
-			draw_list->AddText(sort_pos, colors.text, sort_text.c_str());
+		if (show_sort_text) {
+			draw_list->AddText(sort_pos, colors.text, cache.sortText.c_str());
 			
-			if (IsMouseHoveringRect(sort_pos, ImVec2(sort_pos.x + ImGui::CalcTextSize(sort_text.c_str()).x, sort_pos.y + font_size))) {
+			if (IsMouseHoveringRect(sort_pos, ImVec2(sort_pos.x + cache.sortWidth, sort_pos.y + font_size))) {
 				UINotification::ShowPropertyTooltip(sort_property);
 			}
 		}
@@ -2434,16 +2701,16 @@ namespace Modex
 
 		const auto status_icon = !valid_target ? invalid_icon : (!valid_type ? warning_icon : valid_icon);
 
-		const auto status_color = warning ? "ERROR" : 
-			tableTargetRef->IsPlayerRef() ? "SUCCESS" : "WARN";
+		const auto status_color = warning ? ThemeColor::Error : 
+			tableTargetRef->IsPlayerRef() ? ThemeColor::Success : ThemeColor::Warn;
 
 
 		ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0.0f, 0.0f));
 		ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, ImVec2(ImGui::GetFontSize(), 3.0f));
 		ImGui::PushStyleVar(ImGuiStyleVar_ButtonTextAlign, ImVec2(0.5f, 0.5f));
-		ImGui::PushStyleColor(ImGuiCol_Button, ThemeConfig::GetColor("NONE"));
+		ImGui::PushStyleColor(ImGuiCol_Button, ThemeConfig::GetColor(ThemeColor::None));
 		ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ThemeConfig::GetColor(status_color));
-		ImGui::PushStyleColor(ImGuiCol_ButtonActive, ThemeConfig::GetColor("NONE"));
+		ImGui::PushStyleColor(ImGuiCol_ButtonActive, ThemeConfig::GetColor(ThemeColor::None));
 		
 		ImGui::SameLine();
 
@@ -2596,7 +2863,7 @@ namespace Modex
 	// a_valueWidth is to determine avaiable column space before EOL.
 	void UITable::CustomSortColumn()
 	{
-		const static ImVec4 text_col = ThemeConfig::GetColor("TEXT_HEADER");
+		const ImVec4 text_col = ThemeConfig::GetColor(ThemeColor::TextHeader);
 
 		constexpr auto combo_flags = ImGuiComboFlags_HeightLarge;
 		ImGui::PushStyleColor(ImGuiCol_FrameBg, ImVec4(0, 0, 0, 0));
@@ -2646,11 +2913,11 @@ namespace Modex
 
 	void UITable::DrawHeader()
 	{
-		static const ImVec4 text_col = ThemeConfig::GetColor("TEXT_HEADER");
+		const ImVec4 text_col = ThemeConfig::GetColor(ThemeColor::TextHeader);
 
 		ImGui::PushID("##Modex::Table::Header");
 
-		ImGui::PushStyleColor(ImGuiCol_Separator, ThemeConfig::GetColor("PRIMARY"));
+		ImGui::PushStyleColor(ImGuiCol_Separator, ThemeConfig::GetColor(ThemeColor::Primary));
 
 		std::string header_plugin = this->showFormID ? Translate("FORMID") : Translate("PLUGIN");
 		std::string header_name = this->showEditorID ? Translate("EDITORID") : Translate("NAME");
@@ -2827,6 +3094,17 @@ namespace Modex
 
 	void UITable::Draw(const TableList& _tableList)
 	{
+		const auto draw_start = ProfileClock::now();
+
+		// Batch commands bump the revision once they finish; pick that up before flushing.
+		if (HasFlag(ModexTableFlag_Inventory) || dragDropHandle == DragDropHandle::Inventory) {
+			if (const uint32_t revision = Commands::InventoryRevision.load(std::memory_order_relaxed); revision != inventoryRevision) {
+				inventoryRevision = revision;
+				RequestRefresh(RefreshReason_Inventory);
+			}
+		}
+
+		FlushRefresh();
 		UpdateLayout();
 
 		if (!HasFlag(ModexTableFlag_APIMode)) {
@@ -2878,7 +3156,7 @@ namespace Modex
 				TableList* a_items = (TableList*)self->UserData;
 				return (*a_items)[idx]->m_tableID;  // Index -> TableID
 			};
-			selectionStorage.ApplyRequests(ms_io);
+			ApplySelectionRequests(ms_io);
 			
 			// Start clipper and iterate through table's item list.
 			clipper.Begin(ITEMS_COUNT, LayoutItemStep.y);
@@ -2890,11 +3168,21 @@ namespace Modex
 			HandleKeyboardNavigation(_tableList);
 
 			ImGui::PushFont(NULL, styleFontSize);
+			ValidateRowCache();
+
+			profile.clipStart = 0;
+			profile.clipEnd = 0;
 
 			while (clipper.Step()) {
 				const int item_start = clipper.DisplayStart;
 				const int item_end = clipper.DisplayEnd;
 
+				// Forced single-item steps (nav, range source) are smaller than the visible window.
+				if (item_end - item_start > profile.clipEnd - profile.clipStart) {
+					profile.clipStart = item_start;
+					profile.clipEnd = item_end;
+				}
+
 				for (int line_idx = item_start; line_idx < item_end; line_idx++) {
 					const int item_min_idx_for_current_line = line_idx * COLUMN_COUNT;
 					const int item_max_idx_for_current_line = (std::min)((line_idx + 1) * COLUMN_COUNT, ITEMS_COUNT);
@@ -2938,18 +3226,6 @@ namespace Modex
 							HandleItemHoverPreview(item_data);
 						}
 
-						if (item_data != itemPreview) {
-							if (!ImGui::IsAnyItemHovered()) {
-								if (GetSelectionCount() > 0) {
-									itemPreview = std::make_unique<BaseObject>(*GetSelection()[0]);
-								} else {
-									if (!ImGui::IsPopupOpen("", ImGuiPopupFlags_AnyPopup | ImGuiPopupFlags_AnyPopupLevel)) {
-										itemPreview = nullptr;
-									}
-								}
-							}
-						}
-
 						if (ImGui::IsItemClicked(ImGuiMouseButton_Left)) {
 							navPositionID = item_data->m_tableID;
 						}
@@ -3016,12 +3292,25 @@ namespace Modex
 			ImGui::PopFont();
 
 			ms_io = ImGui::EndMultiSelect();
-			selectionStorage.ApplyRequests(ms_io);
+			ApplySelectionRequests(ms_io);
+
+			// Fall back to the selection lead when nothing is hovered. Resolved once per frame
+			// from the cached selection, and only re-copied when the lead item actually changes.
+			if (ITEMS_COUNT > 0 && !ImGui::IsAnyItemHovered()) {
+				if (const BaseObject* lead = GetSelectionLead(); lead != nullptr) {
+					SetItemPreview(lead);
+				} else if (!ImGui::IsPopupOpen("", ImGuiPopupFlags_AnyPopup | ImGuiPopupFlags_AnyPopupLevel)) {
+					SetItemPreview(nullptr);
+				}
+			}
 		}
 
 		ImGui::EndChild();
 
 		HandleDragDropBehavior();
+
+		profile.drawMs[profile.drawOffset] = ElapsedMs(draw_start);
+		profile.drawOffset = (profile.drawOffset + 1) % Profile::HISTORY;
 	}
 
 	void UITable::DrawDebugToolkit()
@@ -3034,6 +3323,49 @@ namespace Modex
 		if (UICustom::Settings_ToggleButton("Autotest Table Filters", test_filters)) {
 			// test_filters = !test_filters;
 		}
+
+		if (UICustom::Settings_ToggleButton("Show Table Profiler", show_profiler)) {
+			// show_profiler = !show_profiler;
+		}
+
+		if (show_profiler) {
+			DrawProfiler();
+		}
+	}
+
+	void UITable::DrawProfiler()
+	{
+		ImGui::SeparatorText("Refresh");
+		ImGui::Text("Total: %.3f ms (#%u)", profile.refreshMs, profile.refreshCount);
+		ImGui::Text("Requests: %u coalesced, reasons 0x%02X", profile.refreshRequests, profile.lastReasons);
+		ImGui::Text("Search: %.3f ms  Filter: %.3f ms", profile.searchMs, profile.filterMs);
+		ImGui::Text("Sort: %.3f ms  TableIDs: %.3f ms", profile.sortMs, profile.tableIDsMs);
+		ImGui::Text("Last header re-sort: %.3f ms", profile.resortMs);
+		ImGui::Text("Rows: %u scanned, %u emitted, ~%u est. row allocs", profile.rowsScanned, profile.rowsEmitted, profile.estRowAllocs);
+
+		float draw_avg = 0.0f;
+		float draw_max = 0.0f;
+		for (const float ms : profile.drawMs) {
+			draw_avg += ms;
+			draw_max = (std::max)(draw_max, ms);
+		}
+		draw_avg /= static_cast<float>(Profile::HISTORY);
+
+		ImGui::SeparatorText("Draw");
+		const std::string overlay = std::format("avg {:.3f} ms / max {:.3f} ms", draw_avg, draw_max);
+		ImGui::PlotLines("##UITable::DrawTime", profile.drawMs.data(), Profile::HISTORY, profile.drawOffset, overlay.c_str(), 0.0f, (std::max)(draw_max, 1.0f), ImVec2(ImGui::GetContentRegionAvail().x, ImGui::GetFrameHeight() * 2.0f));
+		ImGui::Text("Clipper: rows %d - %d of %d", profile.clipStart, profile.clipEnd, static_cast<int>(tableList.size()));
+
+		const auto& stats = Commands::Stats;
+		ImGui::SeparatorText("Commands");
+		ImGui::Text("Batches: %u  Tasks: %u", stats.batches.load(std::memory_order_relaxed), stats.tasks.load(std::memory_order_relaxed));
+		ImGui::Text("Items: %u  Events: %u", stats.items.load(std::memory_order_relaxed), stats.events.load(std::memory_order_relaxed));
+		ImGui::Text("Last batch: %.3f ms", stats.lastBatchMs.load(std::memory_order_relaxed));
+
+		const auto& scheduler = TaskScheduler::GetSingleton()->GetStats();
+		ImGui::SeparatorText("Scheduler");
+		ImGui::Text("Pending: %u  Steps: %u  Completed: %u", scheduler.pending.load(std::memory_order_relaxed), scheduler.steps.load(std::memory_order_relaxed), scheduler.completed.load(std::memory_order_relaxed));
+		ImGui::Text("Last tick: %.3f ms", scheduler.lastTickMs.load(std::memory_order_relaxed));
 	}
 
 	// Use ImGuiIO delta to incrementally select table filter nodes one by one until completion
@@ -3059,7 +3391,7 @@ namespace Modex
 					FilterNode* node = *it;
 					if (node) {
 						this->filterSystem->ActivateNodeByID(node->id, true);
-						this->Refresh();
+						this->RequestRefresh(RefreshReason_Filter);
 					}
 					break;
 				}
@@ -3095,14 +3427,14 @@ namespace Modex
 			accumulator = 0.0f;
 
 			// Clear previous selection
-			selectionStorage.Clear();
+			ClearSelection();
 
 			// Select the current index
 			if (current_index < tableSize) {
 				auto& item = (*selectionList)[current_index];
 				if (item) {
-					selectionStorage.SetItemSelected(item->m_tableID, true);
-					this->itemPreview = std::make_unique<BaseObject>(*item);
+					SetItemSelected(item->m_tableID, true);
+					SetItemPreview(item.get());
 				}
 			}
 
@@ -7,6 +7,11 @@
 #include "ui/core/SortSystem.h"
 #include "ui/core/SearchSystem.h"
 
+namespace Modex::Commands
+{
+	struct BatchItem;
+}
+
 namespace Modex
 {
 	class UITable
@@ -32,6 +37,59 @@ namespace Modex
 			ImU32 error;
 		};
 
+		// Per-row strings that only change with data, layout or font. Avoids rebuilding and
+		// re-truncating every visible label every frame.
+		struct RowCache
+		{
+			const BaseObject*   source = nullptr;
+			int                 quantity = 0;
+			std::string         name;
+			std::string         plugin;
+			std::string         sortText;
+			float               nameWidth = 0.0f;
+			float               sortWidth = 0.0f;
+		};
+
+		struct RowCacheKey
+		{
+			ImFont*             font = nullptr;
+			float               fontSize = 0.0f;
+			float               columnWidth = 0.0f;
+			float               itemWidth = 0.0f;
+			PropertyType        sortProperty = PropertyType::kNone;
+			bool                showEditorID = false;
+			bool                showFormID = false;
+			bool                showItemIcon = false;
+
+			bool operator==(const RowCacheKey&) const = default;
+		};
+
+		// Developer-mode timings surfaced in DrawDebugToolkit(). Values describe the most recent
+		// Refresh(), except resortMs, which covers the last header-driven re-sort outside of one.
+		// The draw history is a ring buffer of whole Draw() calls.
+		struct Profile
+		{
+			static constexpr int HISTORY = 120;
+
+			float               refreshMs = 0.0f;
+			float               searchMs = 0.0f;
+			float               filterMs = 0.0f;
+			float               sortMs = 0.0f;
+			float               tableIDsMs = 0.0f;
+			float               resortMs = 0.0f;
+			uint32_t            rowsScanned = 0;
+			uint32_t            rowsEmitted = 0;
+			uint32_t            estRowAllocs = 0; // estimated from row count and list growth, not measured
+			uint32_t            refreshCount = 0;
+			uint32_t            refreshRequests = 0;
+			uint32_t            lastReasons = 0;
+
+			std::array<float, HISTORY> drawMs{};
+			int                 drawOffset = 0;
+			int                 clipStart = 0;
+			int                 clipEnd = 0;
+		};
+
 		ImGuiMultiSelectFlags MULTI_SELECT_FLAGS = 
 		ImGuiMultiSelectFlags_ClearOnClickVoid  | ImGuiMultiSelectFlags_SelectOnClickRelease |
 		ImGuiMultiSelectFlags_NoAutoSelect      | ImGuiMultiSelectFlags_BoxSelect1d | 
@@ -92,6 +150,7 @@ namespace Modex
 
 		inline static bool test_selection = false;
 		inline static bool test_filters = false;
+		inline static bool show_profiler = false;
 
 	public:
 		enum TableFlag : uint32_t {
@@ -112,6 +171,22 @@ namespace Modex
 			SHOWFAVORITE,
 		};
 
+		// Why a rebuild was requested. Reasons accumulate until the next flush so several
+		// requests in one frame (or one debounce window) collapse into a single Refresh().
+		enum RefreshReason : uint32_t {
+			RefreshReason_None = 0,
+			RefreshReason_Filter = 1 << 0,
+			RefreshReason_Search = 1 << 1,
+			RefreshReason_Plugin = 1 << 2,
+			RefreshReason_Mode = 1 << 3,
+			RefreshReason_Kit = 1 << 4,
+			RefreshReason_Inventory = 1 << 5,
+			RefreshReason_Favorites = 1 << 6,
+			RefreshReason_Target = 1 << 7
+		};
+
+		static constexpr float SEARCH_DEBOUNCE = 0.15f;
+
 		UITable(const std::string& a_dataID, bool a_shared, Ownership a_type, uint32_t a_flags);
 		~UITable();
 		UITable(const UITable&) = delete;
@@ -139,6 +214,9 @@ namespace Modex
 		//                      core behaviors
 		void                    Draw(const TableList& a_tableList);
 		void                    Refresh();
+		void                    RequestRefresh(uint32_t a_reasons, float a_debounce = 0.0f);
+		void                    FlushRefresh();
+		bool                    IsRefreshPending() const { return pendingRefresh != RefreshReason_None; }
 
 		Ownership               GetOwnership() { return owner; };
 		TableList*              GetTableListPtr() { return &tableList; }
@@ -146,6 +224,8 @@ namespace Modex
 		const PluginList&       GetPluginList() const { return pluginList; };
 		const TableList&        GetTableList() const { return tableList; }
 		const TableList         GetSelection() const;
+		const std::vector<BaseObject*>& GetSelectedItems() const;
+		const BaseObject*       GetSelectionLead() const;
 		const TableItem&        GetItemPreview() { return itemPreview; }
 
 		//                      class builder methods
@@ -208,10 +288,13 @@ namespace Modex
 		void                    FilterInventoryImpl();
 		void                    UpdateActiveInventoryTables();
 		void                    UpdateImGuiTableIDs();
+		void                    RebuildTableList();
+		void                    EmitRow(TableItem&& a_item);
 		void                    SyncChangesToKit();
 		void                    BuildPluginList();
 
 		std::vector<BaseObject> GetReferenceInventory();
+		std::vector<Commands::BatchItem> CollectSelectionBatch(uint32_t a_count, const std::function<bool(const BaseObject*)>& a_predicate) const;
 		
 		//                      sorting
 		bool                    SortFn(const std::unique_ptr<BaseObject>& a, const std::unique_ptr<BaseObject>& b);
@@ -224,6 +307,17 @@ namespace Modex
 		void                    HandleLeftClickBehavior(const std::unique_ptr<BaseObject>& a_item);
 		void                    HandleRightClickBehavior(const std::unique_ptr<BaseObject>& a_item);
 		bool                    IsMouseHoveringRect(const ImVec2& a_min, const ImVec2& a_max);
+
+		//                      row render cache
+		void                    ValidateRowCache();
+		void                    InvalidateRowCache() { rowCache.clear(); }
+		RowCache&               AcquireRowCache(const BaseObject* a_item, bool& a_rebuild);
+
+		//                      selection index
+		void                    ClearSelection();
+		void                    SetItemSelected(ImGuiID a_id, bool a_selected);
+		void                    ApplySelectionRequests(ImGuiMultiSelectIO* a_io);
+		void                    SetItemPreview(const BaseObject* a_item);
 		
 		//                      debug
 		void                    Test_TableSelection();
@@ -242,6 +336,7 @@ namespace Modex
 		//                      widget groups
 		void                    DrawTableSettingsPopup();
 		void                    DrawDebugToolkit();
+		void                    DrawProfiler();
 		void                    DrawFormFilterTree();
 		void                    DrawSearchBar();
 		void                    DrawStatusBar();
@@ -250,6 +345,18 @@ namespace Modex
 		DragDropHandle                      dragDropHandle;
 		std::map<DragDropHandle, UITable*>     dragDropSourceList;
 		ImGuiSelectionBasicStorage          selectionStorage;
+		mutable std::vector<BaseObject*>    selectionCache;
+		mutable bool                        selectionDirty = true;
+		const BaseObject*                   previewSource = nullptr;
+		std::vector<RowCache>               rowCache;
+		RowCacheKey                         rowCacheKey;
+		Profile                             profile;
+		bool                                refreshing = false;
+		uint32_t                            pendingRefresh = RefreshReason_None;
+		double                              refreshDeadline = 0.0;
+		bool                                pendingImmediate = false;
+		uint32_t                            inventoryRevision = 0;
+		uint32_t                            pendingRequests = 0;
 		SelectionChangedCallback            m_selectionChangedCallback;
 	};
 }
@@ -226,9 +226,9 @@ namespace Modex
 				ImVec4 button_color;
 
 				if (child->colorIndex >= 0) {
-					button_color = ThemeConfig::GetColor(std::format("FILTER_{}", child->colorIndex));
+					button_color = ThemeConfig::GetColor(ThemeConfig::GetFilterColor(static_cast<uint32_t>(child->colorIndex)));
 				} else {
-					button_color = ThemeConfig::GetColor("PRIMARY");
+					button_color = ThemeConfig::GetColor(ThemeColor::Primary);
 				}
 
 				if (UIContainers::TabButton(child->displayName.c_str(), ImVec2(button_width, 0.0f), child->isSelected, button_color)) {
@@ -343,22 +343,30 @@ namespace Modex
 		}
 	}
 
-	bool FilterSystem::ShouldShowItem(const BaseObject* a_item) const {
-		if (!m_rootNode || !a_item) { return true; }
-		
-		std::map<FilterNode*, std::vector<FilterNode*>> nodesByParent;
-		CollectSelectedNodesByParent(m_rootNode.get(), nodesByParent);
-		
+	CompiledFilter FilterSystem::CompileFilter(FilterLogic a_logic) const {
+		CompiledFilter compiled;
+		compiled.logic = a_logic;
+
 		// No filters active = show everything
-		if (nodesByParent.empty()) {
-			return true;
+		if (!m_rootNode || GetSelectedRootNode() == nullptr) {
+			return compiled;
 		}
 
-		if (GetSelectedRootNode() == nullptr) {
-			return true;
-		}
-		
+		std::map<FilterNode*, std::vector<FilterNode*>> nodesByParent;
+		CollectSelectedNodesByParent(m_rootNode.get(), nodesByParent);
+
+		compiled.groups.reserve(nodesByParent.size());
 		for (const auto& [parent, nodes] : nodesByParent) {
+			compiled.groups.emplace_back(nodes.begin(), nodes.end());
+		}
+
+		return compiled;
+	}
+
+	bool CompiledFilter::Matches(const BaseObject* a_item) const {
+		if (!a_item) { return true; }
+
+		for (const auto& nodes : groups) {
 			bool matchedAnyInGroup = false;
 			bool matchedAllInGroup = true;
 			
@@ -373,8 +381,6 @@ namespace Modex
 					matchedAnyInGroup = true;
 				}
 			}
-			
-			const FilterLogic logic = magic_enum::enum_cast<FilterLogic>(UserConfig::Get().filterLogic).value_or(FilterLogic::OR);
 
 			switch (logic) {
 				case FilterLogic::AND: // ALL must match.
@@ -394,6 +400,18 @@ namespace Modex
 		return true;
 	}
 
+	// Uses the filter logic from the user's settings.
+	CompiledFilter FilterSystem::CompileFilter() const {
+		const FilterLogic logic = magic_enum::enum_cast<FilterLogic>(UserConfig::Get().filterLogic).value_or(FilterLogic::OR);
+		return CompileFilter(logic);
+	}
+
+	bool FilterSystem::ShouldShowItem(const BaseObject* a_item) const {
+		if (!m_rootNode || !a_item) { return true; }
+
+		return CompileFilter().Matches(a_item);
+	}
+
 	void FilterSystem::AssignColorIndices() {
 		if (!m_rootNode) return;
 		
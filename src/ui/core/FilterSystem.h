@@ -239,6 +239,16 @@ namespace Modex
 	};
 
 
+	// A filter selection grouped by parent node, built once and tested against many items.
+	// Within a group nodes combine with `logic`; every group has to pass.
+	struct CompiledFilter
+	{
+		std::vector<std::vector<const FilterNode*>> groups;
+		FilterLogic                                 logic = FilterLogic::OR;
+
+		bool Matches(const BaseObject* a_item) const;
+	};
+
 	class FilterSystem : public ConfigManager
 	{
 	private:
@@ -264,6 +274,8 @@ namespace Modex
 		bool MatchesFilters(const BaseObject& a_item);
 		void RenderNodeAndChildren(FilterNode* node, const float& a_width, int a_depth = 0);
 		bool ShouldShowItem(const BaseObject* a_item) const;
+		CompiledFilter CompileFilter() const;
+		CompiledFilter CompileFilter(FilterLogic a_logic) const;
 
 		void ClearActiveNodes();
 		void ActivateNodeByID(const std::string& a_id, bool a_select);
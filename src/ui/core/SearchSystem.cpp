@@ -76,87 +76,123 @@ namespace Modex
 		}
 	}
 
-	bool SearchSystem::CompareInputToObject(const BaseObject* a_object)
+	SearchQuery::SearchQuery(std::string_view a_input) :
+		m_input(a_input)
 	{
-		std::string compareString;
-		std::string input = m_searchBuffer;
-		std::transform(input.begin(), input.end(), input.begin(),
+		std::transform(m_input.begin(), m_input.end(), m_input.begin(),
 			[](unsigned char c) { return static_cast<char>(std::tolower(c)); });
 
-		if (!input.empty()) {
-			compareString = a_object->GetPropertyByFilter(m_searchKey);
+		if (m_input.empty()) {
+			return;
+		}
+
+		const std::string& input = m_input;
 
-			std::transform(compareString.begin(), compareString.end(), compareString.begin(),
-				[](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+		// If the input is wrapped in quotes, we do an exact match across all parameters.
+		if (input.front() == '"' && input.back() == '"') {
+			m_exact = input.size() > 1 ? input.substr(1, input.size() - 2) : std::string();
+		}
 
-			// If the input is wrapped in quotes, we do an exact match across all parameters.
-			if (!input.empty() && input.front() == '"' && input.back() == '"') {
-				std::string match = input.substr(1, input.size() - 2);
+		// If the input begins with > or < we do a greater than / less than comparison.
+		if (input.front() == '>' || input.front() == '<') {
+			m_comparator = input.front();
 
-				if (compareString == match) {
-					return true;
-				}
+			try {
+				m_number = std::stod(input.substr(1));
+			} catch (const std::exception&) {
+				m_number = std::nullopt;
 			}
+		}
 
-			// If the input begins with > or < we do a greater than / less than comparison.
-			if (!input.empty() && (input.front() == '>' || input.front() == '<')) {
-				char comparator = input.front();
-				std::string match = input.substr(1);
+		// If the input contains a '==' or '!=' we do an (in)equality comparison.
+		if (const size_t pos = input.find("=="); pos != std::string::npos) {
+			m_equals = input.substr(pos + 2);
+		} else if (const size_t neq = input.find("!="); neq != std::string::npos) {
+			m_notEquals = input.substr(neq + 2);
+		}
 
-				// Attempt to convert both strings to numbers.
-				try {
-					double compareValue = std::stod(compareString);
-					double matchValue = std::stod(match);
+		// If the input starts with '%' we do a full regex comparison.
+		if (input.front() == '%') {
+			m_regexMode = true;
 
-					if (comparator == '>' && compareValue > matchValue) {
-						return true;
-					} else if (comparator == '<' && compareValue < matchValue) {
-						return true;
-					}
-				} catch (const std::invalid_argument&) {
-					return false;
-				}
+			try {
+				m_regex.emplace(input.substr(1), std::regex::icase);
+			} catch (const std::regex_error&) {
+				m_regex = std::nullopt;
 			}
+		}
+	}
 
-			// If the input contains a '==' we do an equality comparison.
-			size_t equalityPos = input.find("==");
-			if (equalityPos != std::string::npos) {
-				std::string match = input.substr(equalityPos + 2);
+	bool SearchQuery::Matches(std::string a_value) const
+	{
+		if (m_input.empty()) {
+			return true;
+		}
 
-				if (compareString == match) {
-					return true;
-				} else {
-					return false;
-				}
+		std::transform(a_value.begin(), a_value.end(), a_value.begin(),
+			[](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+		if (m_exact && a_value == *m_exact) {
+			return true;
+		}
+
+		if (m_comparator != 0) {
+			if (!m_number) {
+				return false;
 			}
 
-			// If the input contains a '!=' we do an inequality comparison.
-			size_t inequalityPos = input.find("!=");
-			if (inequalityPos != std::string::npos) {
-				std::string match = input.substr(inequalityPos + 2);
+			try {
+				const double value = std::stod(a_value);
 
-				if (compareString != match) {
+				if (m_comparator == '>' && value > *m_number) {
+					return true;
+				} else if (m_comparator == '<' && value < *m_number) {
 					return true;
-				} else {
-					return false;
 				}
+			} catch (const std::exception&) {
+				return false;
 			}
+		}
 
-			// If the input starts with '%' we do a full regex comparison.
-			if (!input.empty() && input.front() == '%') {
-				std::string pattern = input.substr(1);
-				try {
-					std::regex re(pattern, std::regex::icase);
-					if (std::regex_search(compareString, re)) {
-						return true;
-					}
-				} catch (const std::regex_error&) {
-					return false;
-				}
+		if (m_equals) {
+			return a_value == *m_equals;
+		}
+
+		if (m_notEquals) {
+			return a_value != *m_notEquals;
+		}
+
+		if (m_regexMode) {
+			if (!m_regex) {
+				return false;
 			}
+
+			if (std::regex_search(a_value, *m_regex)) {
+				return true;
+			}
+		}
+
+		return a_value.find(m_input) != std::string::npos;
+	}
+
+	bool SearchQuery::Matches(const BaseObject* a_object, const FilterProperty& a_key) const
+	{
+		if (m_input.empty()) {
+			return true;
+		}
+
+		return Matches(a_object->GetPropertyByFilter(a_key));
+	}
+
+	// The query is rebuilt only when the search text changes, not per row.
+	bool SearchSystem::CompareInputToObject(const BaseObject* a_object)
+	{
+		if (m_queryText != m_searchBuffer) {
+			m_queryText = m_searchBuffer;
+			m_query = SearchQuery(m_queryText);
 		}
 
-		return compareString.find(input) != std::string::npos;
+		return m_query.Matches(a_object, m_searchKey);
 	}
 
 	// Backwards compatible for tables, use for extracting kit names.
@@ -318,7 +354,7 @@ namespace Modex
 	bool SearchSystem::InputTextComboBox(const char* a_label, char* a_buffer,
 		std::string& a_preview, 
 		size_t a_size, 
-		std::vector<std::string> a_items, 
+		const std::vector<std::string>& a_items, 
 		float a_width)
 	{
 		// Generate unique IDs for this widget instance
@@ -339,7 +375,7 @@ namespace Modex
 		icon_pos.x += a_width - ImGui::GetFrameHeightWithSpacing() + ImGui::GetStyle().FramePadding.x;
 		icon_pos.y += (ImGui::GetItemRectSize().y / 2.0f) - (ImGui::GetFontSize() / 2.0f);
 
-		DrawList->AddText(icon_pos, ThemeConfig::GetColorU32("TEXT", ImGui::GetStyle().Alpha), ICON_LC_SEARCH);
+		DrawList->AddText(icon_pos, ThemeConfig::GetColorU32(ThemeColor::Text, ImGui::GetStyle().Alpha), ICON_LC_SEARCH);
 		ImGui::PopFont();
 		ImGui::PopStyleVar(2);
 
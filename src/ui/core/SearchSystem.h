@@ -33,6 +33,31 @@ namespace Modex
 
 	using SearchList = std::vector<SearchItem>;
 
+	// Search input parsed once: "quoted" exact match, >n / <n numeric comparison, ==x / !=x
+	// equality, %regex, otherwise substring. Matches() keeps the original evaluation order,
+	// including falling back to a substring match when a special form doesn't match.
+	class SearchQuery
+	{
+	public:
+		SearchQuery() = default;
+		explicit SearchQuery(std::string_view a_input);
+
+		bool IsEmpty() const { return m_input.empty(); }
+		bool Matches(std::string a_value) const;
+		bool Matches(const BaseObject* a_object, const FilterProperty& a_key) const;
+
+	private:
+		std::string                m_input;
+
+		std::optional<std::string> m_exact;
+		char                       m_comparator = 0;
+		std::optional<double>      m_number;
+		std::optional<std::string> m_equals;
+		std::optional<std::string> m_notEquals;
+		bool                       m_regexMode = false;
+		std::optional<std::regex>  m_regex;
+	};
+
 	class SearchSystem : public ConfigManager
 	{
 	private:
@@ -48,6 +73,9 @@ namespace Modex
 		SearchList     m_filteredList;
 		SearchList     m_navList;
 		SearchItem     m_navSelection;
+
+		std::string    m_queryText;
+		SearchQuery    m_query;
 		
 	public:
 		SearchSystem(const std::filesystem::path& a_path) :
@@ -134,7 +162,7 @@ namespace Modex
 		}
 
 		bool CompareInputToObject(const BaseObject* a_object);
-		bool InputTextComboBox(const char* a_label, char* a_buffer, std::string& a_preview, size_t a_size, std::vector<std::string> a_items, float a_width);
+		bool InputTextComboBox(const char* a_label, char* a_buffer, std::string& a_preview, size_t a_size, const std::vector<std::string>& a_items, float a_width);
 
 	private:
 		std::string ExtractDisplayName(const std::string& a_fullName);
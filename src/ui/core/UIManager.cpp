@@ -13,6 +13,8 @@
 #include "ui/modules/equipment/EquipmentModule.h"
 
 #include "localization/FontManager.h"
+#include "core/WorkerPool.h"
+#include "config/PersistenceService.h"
 #include "imgui_impl_win32.h"
 #include "imgui_impl_dx11.h"
 
@@ -234,6 +236,8 @@ namespace Modex
 			case WM_DESTROY: {
 				PrettyLog::Trace("Window Destroyed. Modex shutting down..."); 
 				UIManager::GetSingleton()->Shutdown();
+				PersistenceService::GetSingleton()->Flush();
+				WorkerPool::GetSingleton()->Shutdown();
 				break;
 			}
 			default:
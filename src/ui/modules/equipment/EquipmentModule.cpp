@@ -13,9 +13,69 @@ namespace Modex
 {
 	void EquipmentModule::Draw()
 	{
+		SyncExternalKitChanges();
 		DrawTabMenu();
 	}
 
+	// Picks up kits re-indexed by EquipmentConfig after they changed on disk outside the game.
+	void EquipmentModule::SyncExternalKitChanges()
+	{
+		const uint32_t epoch = EquipmentConfig::GetEpoch();
+		if (epoch == m_kitEpoch) {
+			return;
+		}
+
+		m_kitEpoch = epoch;
+
+		if (m_selectedKit.empty()) {
+			return;
+		}
+
+		if (EquipmentConfig::GetEquipmentList().contains(m_selectedKit.m_key)) {
+			m_selectedKit = EquipmentConfig::KitLookup(m_selectedKit.m_key).value_or(Kit());
+		} else {
+			m_selectedKit = Kit();
+		}
+
+		if (m_tables.size() > 1) {
+			m_tables[1]->RequestRefresh(UITable::RefreshReason_Kit);
+		}
+	}
+
+	// Plugin filter entries, with "show all" in front.
+	const std::vector<std::string>& EquipmentModule::GetPluginOptions()
+	{
+		const uint32_t revision = EquipmentConfig::GetRevision();
+		const std::string_view show_all = Translate("SHOWALL");
+
+		if (revision != m_pluginOptionsRevision || m_pluginOptions.empty() || m_pluginOptions.front() != show_all) {
+			const auto& plugins = EquipmentConfig::GetKitPlugins();
+
+			m_pluginOptions.clear();
+			m_pluginOptions.reserve(plugins.size() + 1);
+			m_pluginOptions.emplace_back(show_all);
+			m_pluginOptions.insert(m_pluginOptions.end(), plugins.begin(), plugins.end());
+			m_pluginOptionsRevision = revision;
+		}
+
+		return m_pluginOptions;
+	}
+
+	// Kit keys narrowed to the selected plugin, or every kit when no plugin is selected.
+	const std::vector<std::string>& EquipmentModule::GetKitKeys()
+	{
+		if (m_kitPlugin.empty()) {
+			return EquipmentConfig::GetEquipmentListSortedKeys();
+		}
+
+		if (const uint32_t revision = EquipmentConfig::GetRevision(); revision != m_filteredKeysRevision) {
+			m_filteredKeys = EquipmentConfig::FindKitsWithPlugin(m_kitPlugin);
+			m_filteredKeysRevision = revision;
+		}
+
+		return m_filteredKeys;
+	}
+
 	// Used exclusively in the equipment module window for rendering Kit actionable buttons.
 	void EquipmentModule::DrawKitActionsPanel(const ImVec2 &a_pos, const ImVec2 &a_size)
 	{
@@ -31,16 +91,34 @@ namespace Modex
 			const float button_width = ImGui::GetContentRegionAvail().x;
 			const float button_height = ImGui::GetFrameHeightWithSpacing();
 
-			auto equipment_keys = EquipmentConfig::GetEquipmentListSortedKeys();
+			// Narrows the kit dropdown below to kits that use items from one plugin.
+			const auto& kit_plugins = GetPluginOptions();
+			std::string plugin_preview = m_kitPlugin.empty() ? Translate("SHOWALL") : m_kitPlugin;
+
+			static bool plugin_hovered = false;
+			ImGui::PushStyleColor(ImGuiCol_FrameBg, plugin_hovered ? ThemeConfig::GetHover(ThemeColor::BgLight) : ThemeConfig::GetColor(ThemeColor::BgLight));
+			if (m_searchSystem->InputTextComboBox("##KitActionBar::Plugin", m_pluginBuffer, plugin_preview, 256, kit_plugins, button_width)) {
+				m_kitPlugin = std::string_view(m_pluginBuffer) == Translate("SHOWALL") ? std::string() : std::string(m_pluginBuffer);
+				m_pluginBuffer[0] = '\0';
+				m_filteredKeysRevision = UINT32_MAX;
+			}
+			ImGui::PopStyleColor();
+			plugin_hovered = ImGui::IsItemHovered();
+
+			if (ImGui::IsItemHovered(ImGuiHoveredFlags_DelayNormal | ImGuiHoveredFlags_NoSharedDelay)) {
+				UICustom::FancyTooltip("KIT_PLUGIN_TOOLTIP");
+			}
+
+			const auto& equipment_keys = GetKitKeys();
 			std::string preview_string = m_selectedKit.GetNameTail();
 
 			static bool hovered = false;
-			ImGui::PushStyleColor(ImGuiCol_FrameBg, hovered ? ThemeConfig::GetHover("BG_LIGHT") : ThemeConfig::GetColor("BG_LIGHT"));
+			ImGui::PushStyleColor(ImGuiCol_FrameBg, hovered ? ThemeConfig::GetHover(ThemeColor::BgLight) : ThemeConfig::GetColor(ThemeColor::BgLight));
 			if (m_searchSystem->InputTextComboBox("##KitActionBar::Search", m_searchBuffer, preview_string, 256, equipment_keys, button_width)) {
 				m_selectedKit = EquipmentConfig::KitLookup(m_searchBuffer).value_or(Kit());
 
 				m_searchBuffer[0] = '\0';
-				m_tables[1]->Refresh();
+				m_tables[1]->RequestRefresh(UITable::RefreshReason_Kit);
 			}
 			ImGui::PopStyleColor();
 			hovered = ImGui::IsItemHovered();
@@ -53,7 +131,7 @@ namespace Modex
 					[&](std::string a_input) {
 						if (const auto success = EquipmentConfig::RenameKit(m_selectedKit, a_input); success.has_value()) {
 							m_selectedKit = std::move(success.value());
-							m_tables[1]->Refresh();
+							m_tables[1]->RequestRefresh(UITable::RefreshReason_Kit);
 						}
 					}
 				);
@@ -69,7 +147,7 @@ namespace Modex
 						if (const auto success = EquipmentConfig::KitLookup(a_input); success.has_value()) {
 							m_selectedKit = std::move(success.value());
 							ImFormatString(m_searchBuffer, 256, "");
-							m_tables[1]->Refresh();
+							m_tables[1]->RequestRefresh(UITable::RefreshReason_Kit);
 						}
 					}
 				);
@@ -84,7 +162,7 @@ namespace Modex
 						if (auto new_kit = EquipmentConfig::CreateKit(a_input); new_kit.has_value()) {
 							ImFormatString(m_searchBuffer, 256, "");
 							m_selectedKit = std::move(new_kit.value());
-							m_tables[1]->Refresh();
+							m_tables[1]->RequestRefresh(UITable::RefreshReason_Kit);
 						}
 					}
 				);
@@ -95,7 +173,7 @@ namespace Modex
 				if (auto new_kit = EquipmentConfig::CopyKit(m_selectedKit); new_kit.has_value()) {
 					ImFormatString(m_searchBuffer, 256, "");
 					m_selectedKit = std::move(new_kit.value());
-					m_tables[1]->Refresh();
+					m_tables[1]->RequestRefresh(UITable::RefreshReason_Kit);
 				}
 			}
 
@@ -108,7 +186,7 @@ namespace Modex
 						ImFormatString(m_searchBuffer, 256, "");
 						EquipmentConfig::DeleteKit(m_selectedKit);
 						m_selectedKit = Kit();
-						m_tables[1]->Refresh();
+						m_tables[1]->RequestRefresh(UITable::RefreshReason_Kit);
 					}
 				);
 			}
@@ -122,9 +200,9 @@ namespace Modex
 				const bool shift_down = ImGui::GetIO().KeyShift;
 
 				{ // Side-by-side buttons group.
-					ImGui::PushStyleColor(ImGuiCol_Button, ThemeConfig::GetColor("SECONDARY"));
-					ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ThemeConfig::GetHover("SECONDARY"));
-					ImGui::PushStyleColor(ImGuiCol_ButtonActive, ThemeConfig::GetActive("SECONDARY"));
+					ImGui::PushStyleColor(ImGuiCol_Button, ThemeConfig::GetColor(ThemeColor::Secondary));
+					ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ThemeConfig::GetHover(ThemeColor::Secondary));
+					ImGui::PushStyleColor(ImGuiCol_ButtonActive, ThemeConfig::GetActive(ThemeColor::Secondary));
 					if (UICustom::ActionButton("CONTAINER_VIEW_KIT", ImVec2(half_width, button_height), action_allowed)) {
 						PlayerChestSpawn::GetSingleton()->PopulateChestWithKit(m_selectedKit);
 					}
@@ -141,10 +219,8 @@ namespace Modex
 					std::unordered_set<std::string> dependencies;
 					std::string message;
 
-					for (auto& item : m_selectedKit.m_items) {
-						if (!dependencies.contains(item->m_plugin)) {
-							dependencies.insert(item->m_plugin);
-						}
+					for (const auto& item : m_selectedKit.m_items) {
+						dependencies.emplace(item.GetPlugin());
 					}
 
 					auto pluginList = Data::GetSingleton()->GetModulePluginListSorted(Ownership::All, PluginSort::Load_Order_Ascending);
@@ -208,6 +284,7 @@ namespace Modex
 	EquipmentModule::EquipmentModule() 
 	{
 		memset(m_searchBuffer, 0, sizeof(m_searchBuffer));
+		memset(m_pluginBuffer, 0, sizeof(m_pluginBuffer));
 
 		// static
 		m_searchSystem = std::make_unique<SearchSystem>(std::filesystem::path());
@@ -215,6 +292,7 @@ namespace Modex
 
 		const auto& last_kit_key = UserData::Get<std::string>("Equipment::LastSelectedKit", "");
 		m_selectedKit = EquipmentConfig::KitLookup(last_kit_key).value_or(Kit());
+		m_kitEpoch = EquipmentConfig::GetEpoch();
 		// Setup available layouts for this module.
 		// m_layouts.push_back({Translate("TAB_EQUIPMENT"), true, DrawEquipmentLayout});
 		m_layouts.push_back({Translate("TAB_EQUIPMENT"), true,
@@ -9,7 +9,20 @@ namespace Modex
 	private:
 		Kit                             m_selectedKit;
 		char                            m_searchBuffer[256];
+		char                            m_pluginBuffer[256];
+		std::string                     m_kitPlugin; // empty shows kits from every plugin
 		std::unique_ptr<SearchSystem>   m_searchSystem;
+		uint32_t                        m_kitEpoch = 0;
+
+		// Dropdown lists, rebuilt only when the kit index changes or the plugin filter does.
+		std::vector<std::string>        m_pluginOptions;
+		std::vector<std::string>        m_filteredKeys;
+		uint32_t                        m_pluginOptionsRevision = UINT32_MAX;
+		uint32_t                        m_filteredKeysRevision = UINT32_MAX;
+
+		void                            SyncExternalKitChanges();
+		const std::vector<std::string>& GetPluginOptions();
+		const std::vector<std::string>& GetKitKeys();
 
 	public:
 		EquipmentModule();
@@ -174,7 +174,7 @@ namespace Modex
 			auto player_gold = RE::PlayerCharacter::GetSingleton()->GetGoldAmount();
 			bool can_afford = player_gold >= cost;
 
-			if (!can_afford && m_options.requireTotalCost) ImGui::PushStyleColor(ImGuiCol_TextDisabled, ThemeConfig::GetColor("ERROR"));
+			if (!can_afford && m_options.requireTotalCost) ImGui::PushStyleColor(ImGuiCol_TextDisabled, ThemeConfig::GetColor(ThemeColor::Error));
 			{
 				ImGui::TextDisabled("%s", TranslateFormat("COST", ":"));
 				ImGui::SameLine();
@@ -193,7 +193,7 @@ namespace Modex
 			auto cost = GetTotalCost();
 			bool over_budget = cost > m_options.maxCost;
 
-			if (over_budget) ImGui::PushStyleColor(ImGuiCol_TextDisabled, ThemeConfig::GetColor("ERROR"));
+			if (over_budget) ImGui::PushStyleColor(ImGuiCol_TextDisabled, ThemeConfig::GetColor(ThemeColor::Error));
 			ImGui::TextDisabled("%s %d / %d", Translate("MAX_COST"), cost, m_options.maxCost);
 			if (over_budget) ImGui::PopStyleColor();
 		}
@@ -201,9 +201,9 @@ namespace Modex
 		// Confirm button
 		bool can_confirm = CanConfirm();
 
-		ImGui::PushStyleColor(ImGuiCol_Button, ThemeConfig::GetColor("CONFIRM"));
-		ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ThemeConfig::GetHover("CONFIRM"));
-		ImGui::PushStyleColor(ImGuiCol_ButtonActive, ThemeConfig::GetActive("CONFIRM"));
+		ImGui::PushStyleColor(ImGuiCol_Button, ThemeConfig::GetColor(ThemeColor::Confirm));
+		ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ThemeConfig::GetHover(ThemeColor::Confirm));
+		ImGui::PushStyleColor(ImGuiCol_ButtonActive, ThemeConfig::GetActive(ThemeColor::Confirm));
 
 		if (!can_confirm) {
 			ImGui::BeginDisabled();
@@ -221,9 +221,9 @@ namespace Modex
 
 		ImGui::SameLine();
 
-		ImGui::PushStyleColor(ImGuiCol_Button, ThemeConfig::GetColor("DECLINE"));
-		ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ThemeConfig::GetHover("DECLINE"));
-		ImGui::PushStyleColor(ImGuiCol_ButtonActive, ThemeConfig::GetActive("DECLINE"));
+		ImGui::PushStyleColor(ImGuiCol_Button, ThemeConfig::GetColor(ThemeColor::Decline));
+		ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ThemeConfig::GetHover(ThemeColor::Decline));
+		ImGui::PushStyleColor(ImGuiCol_ButtonActive, ThemeConfig::GetActive(ThemeColor::Decline));
 		if (ImGui::Button(Translate("CLEAR"), ImVec2(ImGui::GetContentRegionAvail().x, 0))) {
 			ClearSelection();
 		}
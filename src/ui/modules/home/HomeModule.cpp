@@ -39,36 +39,36 @@ namespace Modex
 
 		// Card background.
 		ImU32 bg_color = hovered
-			? ThemeConfig::GetColorU32("BG", 0.9f * alpha)
-			: ThemeConfig::GetColorU32("BG", 0.5f * alpha);
+			? ThemeConfig::GetColorU32(ThemeColor::Bg, 0.9f * alpha)
+			: ThemeConfig::GetColorU32(ThemeColor::Bg, 0.5f * alpha);
 		draw_list->AddRectFilled(cursor, ImVec2(cursor.x + a_cardWidth, cursor.y + card_height), bg_color, 4.0f);
 
 		// Left border accent.
-		ImU32 primary_color = ThemeConfig::GetColorU32("PRIMARY", alpha);
+		ImU32 primary_color = ThemeConfig::GetColorU32(ThemeColor::Primary, alpha);
 		draw_list->AddRectFilled(cursor, ImVec2(cursor.x + border_width, cursor.y + card_height), primary_color, 4.0f, ImDrawFlags_RoundCornersLeft);
 
 		// Icon.
 		float text_x = cursor.x + border_width + padding * 2;
 		float text_y = cursor.y + padding;
 		ImGui::PushFont(NULL, icon_size);
-		draw_list->AddText(ImVec2(text_x, text_y), ThemeConfig::GetColorU32("PRIMARY", alpha), a_icon);
+		draw_list->AddText(ImVec2(text_x, text_y), ThemeConfig::GetColorU32(ThemeColor::Primary, alpha), a_icon);
 		ImGui::PopFont();
 
 		// Title (bold).
 		float title_x = text_x + icon_size + padding;
 		ImGui::PushFontBold();
-		draw_list->AddText(ImVec2(title_x, text_y), ThemeConfig::GetColorU32("TEXT", alpha), Translate(a_titleKey));
+		draw_list->AddText(ImVec2(title_x, text_y), ThemeConfig::GetColorU32(ThemeColor::Text, alpha), Translate(a_titleKey));
 		ImGui::PopFont();
 
 		// Description.
 		float desc_y = text_y + ImGui::GetFontSize() * 1.6f;
-		draw_list->AddText(ImVec2(title_x, desc_y), ThemeConfig::GetColorU32("TEXT_DISABLED", alpha), Translate(a_descKey));
+		draw_list->AddText(ImVec2(title_x, desc_y), ThemeConfig::GetColorU32(ThemeColor::TextDisabled, alpha), Translate(a_descKey));
 
 		// Hover arrow.
 		if (hovered) {
 			float arrow_x = cursor.x + a_cardWidth - ImGui::GetFontSize() * 1.5f;
 			float arrow_y = cursor.y + (card_height - ImGui::GetFontSize()) * 0.5f;
-			draw_list->AddText(ImVec2(arrow_x, arrow_y), ThemeConfig::GetColorU32("PRIMARY", alpha), ICON_LC_CHEVRON_RIGHT);
+			draw_list->AddText(ImVec2(arrow_x, arrow_y), ThemeConfig::GetColorU32(ThemeColor::Primary, alpha), ICON_LC_CHEVRON_RIGHT);
 		}
 
 		if (clicked) {
@@ -94,21 +94,21 @@ namespace Modex
 		ImVec2 cursor = ImGui::GetCursorScreenPos();
 
 		// Key background rectangle.
-		ImU32 key_bg = ThemeConfig::GetColorU32("BG", 0.8f * alpha);
-		ImU32 key_border = ThemeConfig::GetColorU32("BORDER", alpha);
+		ImU32 key_bg = ThemeConfig::GetColorU32(ThemeColor::Bg, 0.8f * alpha);
+		ImU32 key_border = ThemeConfig::GetColorU32(ThemeColor::Border, alpha);
 		draw_list->AddRectFilled(cursor, ImVec2(cursor.x + key_width, cursor.y + key_height), key_bg, 3.0f);
 		draw_list->AddRect(cursor, ImVec2(cursor.x + key_width, cursor.y + key_height), key_border, 3.0f);
 
 		// Key text (centered in rect).
 		float key_text_x = cursor.x + (key_width - key_text_size.x) * 0.5f;
 		float key_text_y = cursor.y + (key_height - key_text_size.y) * 0.5f;
-		draw_list->AddText(ImGui::GetFont(), ImGui::GetFontSize(), ImVec2(key_text_x, key_text_y), ThemeConfig::GetColorU32("TEXT", alpha), a_keyLabel);
+		draw_list->AddText(ImGui::GetFont(), ImGui::GetFontSize(), ImVec2(key_text_x, key_text_y), ThemeConfig::GetColorU32(ThemeColor::Text, alpha), a_keyLabel);
 		ImGui::PopFont();
 
 		// Description text.
 		float desc_x = cursor.x + key_width + padding * 2;
 		float desc_y = cursor.y + (key_height - font_size) * 0.5f;
-		draw_list->AddText(ImVec2(desc_x, desc_y), ThemeConfig::GetColorU32("TEXT", alpha), Translate(a_descKey));
+		draw_list->AddText(ImVec2(desc_x, desc_y), ThemeConfig::GetColorU32(ThemeColor::Text, alpha), Translate(a_descKey));
 
 		// Advance cursor.
 		ImGui::Dummy(ImVec2(0, key_height + ImGui::GetStyle().ItemSpacing.y));
@@ -118,7 +118,7 @@ namespace Modex
 	void HomeModule::DrawFeatureSection(const char* a_titleKey, const char* a_descKey)
 	{
 		ImGui::PushFontBold();
-		ImGui::PushStyleColor(ImGuiCol_Text, ThemeConfig::GetColor("PRIMARY", ImGui::GetStyle().Alpha));
+		ImGui::PushStyleColor(ImGuiCol_Text, ThemeConfig::GetColor(ThemeColor::Primary, ImGui::GetStyle().Alpha));
 		ImGui::SeparatorText(Translate(a_titleKey));
 		ImGui::PopStyleColor();
 		ImGui::PopFont();
@@ -182,17 +182,17 @@ namespace Modex
 
 		for (int i = 0; i < num_stats; i++) {
 			// Icon.
-			dl->AddText(ImVec2(x, y), ThemeConfig::GetColorU32("PRIMARY", alpha), stats[i].icon);
+			dl->AddText(ImVec2(x, y), ThemeConfig::GetColorU32(ThemeColor::Primary, alpha), stats[i].icon);
 			x += ImGui::CalcTextSize(stats[i].icon).x + inner_pad;
 
 			// Count (bold).
 			ImGui::PushFontBold();
-			dl->AddText(ImGui::GetFont(), ImGui::GetFontSize(), ImVec2(x, y), ThemeConfig::GetColorU32("TEXT", alpha), count_strs[i]);
+			dl->AddText(ImGui::GetFont(), ImGui::GetFontSize(), ImVec2(x, y), ThemeConfig::GetColorU32(ThemeColor::Text, alpha), count_strs[i]);
 			x += ImGui::CalcTextSize(count_strs[i]).x + inner_pad;
 			ImGui::PopFont();
 
 			// Label.
-			dl->AddText(ImVec2(x, y), ThemeConfig::GetColorU32("TEXT_DISABLED", alpha), Translate(stats[i].labelKey));
+			dl->AddText(ImVec2(x, y), ThemeConfig::GetColorU32(ThemeColor::TextDisabled, alpha), Translate(stats[i].labelKey));
 			x += ImGui::CalcTextSize(Translate(stats[i].labelKey)).x + badge_gap;
 		}
 
@@ -219,8 +219,8 @@ namespace Modex
 
 		// Background.
 		ImU32 bg = hovered
-			? ThemeConfig::GetColorU32("BG", 0.7f * alpha)
-			: ThemeConfig::GetColorU32("BG", 0.4f * alpha);
+			? ThemeConfig::GetColorU32(ThemeColor::Bg, 0.7f * alpha)
+			: ThemeConfig::GetColorU32(ThemeColor::Bg, 0.4f * alpha);
 		dl->AddRectFilled(cursor, ImVec2(cursor.x + a_width, cursor.y + a_height), bg, 4.0f);
 
 		auto* target = UIModule::GetTargetReference();
@@ -228,8 +228,8 @@ namespace Modex
 
 		// Left border color based on target state.
 		ImU32 accent = has_target
-			? ThemeConfig::GetColorU32("PRIMARY", alpha)
-			: ThemeConfig::GetColorU32("WARN", alpha);
+			? ThemeConfig::GetColorU32(ThemeColor::Primary, alpha)
+			: ThemeConfig::GetColorU32(ThemeColor::Warn, alpha);
 		dl->AddRectFilled(cursor, ImVec2(cursor.x + border_width, cursor.y + a_height), accent, 4.0f, ImDrawFlags_RoundCornersLeft);
 
 		float content_x = cursor.x + border_width + padding * 2;
@@ -244,7 +244,7 @@ namespace Modex
 
 		ImGui::PushFontBold();
 		dl->AddText(ImGui::GetFont(), ImGui::GetFontSize(), ImVec2(content_x + icon_w + padding, line_y),
-			ThemeConfig::GetColorU32("TEXT", alpha), Translate(header_key));
+			ThemeConfig::GetColorU32(ThemeColor::Text, alpha), Translate(header_key));
 		ImGui::PopFont();
 
 		// Detail line: name + formID, or hint text.
@@ -257,17 +257,17 @@ namespace Modex
 			char formid_str[16];
 			snprintf(formid_str, sizeof(formid_str), "  [%08X]", target->formID);
 
-			dl->AddText(ImVec2(content_x + padding, detail_y), ThemeConfig::GetColorU32("TEXT", alpha), name);
+			dl->AddText(ImVec2(content_x + padding, detail_y), ThemeConfig::GetColorU32(ThemeColor::Text, alpha), name);
 			float name_w = ImGui::CalcTextSize(name).x;
-			dl->AddText(ImVec2(content_x + padding + name_w, detail_y), ThemeConfig::GetColorU32("TEXT_DISABLED", alpha), formid_str);
+			dl->AddText(ImVec2(content_x + padding + name_w, detail_y), ThemeConfig::GetColorU32(ThemeColor::TextDisabled, alpha), formid_str);
 		} else {
-			dl->AddText(ImVec2(content_x + padding, detail_y), ThemeConfig::GetColorU32("TEXT_DISABLED", alpha), Translate("HOME_TARGET_HINT"));
+			dl->AddText(ImVec2(content_x + padding, detail_y), ThemeConfig::GetColorU32(ThemeColor::TextDisabled, alpha), Translate("HOME_TARGET_HINT"));
 		}
 
 		// Hover hint.
 		if (hovered) {
 			float hint_y = detail_y + ImGui::GetFontSize() * 1.4f;
-			dl->AddText(ImVec2(content_x + padding, hint_y), ThemeConfig::GetColorU32("PRIMARY", 0.8f * alpha), Translate("HOME_TARGET_CLICK"));
+			dl->AddText(ImVec2(content_x + padding, hint_y), ThemeConfig::GetColorU32(ThemeColor::Primary, 0.8f * alpha), Translate("HOME_TARGET_CLICK"));
 		}
 
 		if (clicked) {
@@ -296,18 +296,18 @@ namespace Modex
 
 		// Panel background.
 		dl->AddRectFilled(cursor, ImVec2(cursor.x + a_width, cursor.y + a_height),
-			ThemeConfig::GetColorU32("BG", 0.4f * alpha), 4.0f);
+			ThemeConfig::GetColorU32(ThemeColor::Bg, 0.4f * alpha), 4.0f);
 
 		// Left border accent.
 		dl->AddRectFilled(cursor, ImVec2(cursor.x + border_width, cursor.y + a_height),
-			ThemeConfig::GetColorU32("SECONDARY", alpha), 4.0f, ImDrawFlags_RoundCornersLeft);
+			ThemeConfig::GetColorU32(ThemeColor::Secondary, alpha), 4.0f, ImDrawFlags_RoundCornersLeft);
 
 		float content_x = cursor.x + border_width + padding * 2;
 
 		// Header.
 		ImGui::PushFontBold();
 		dl->AddText(ImGui::GetFont(), ImGui::GetFontSize(), ImVec2(content_x, cursor.y + padding),
-			ThemeConfig::GetColorU32("TEXT", alpha), Translate("HOME_ACTIONS_HEADER"));
+			ThemeConfig::GetColorU32(ThemeColor::Text, alpha), Translate("HOME_ACTIONS_HEADER"));
 		ImGui::PopFont();
 
 		// Action buttons (stacked vertically).
@@ -341,17 +341,17 @@ namespace Modex
 			// Button background on hover.
 			if (btn_hovered) {
 				dl->AddRectFilled(btn_pos, btn_end,
-					ThemeConfig::GetColorU32("BG", 0.6f * alpha), 3.0f);
+					ThemeConfig::GetColorU32(ThemeColor::Bg, 0.6f * alpha), 3.0f);
 			}
 
 			// Icon + label.
 			float text_y = btn_y + (btn_height - ImGui::GetFontSize()) * 0.5f;
 			dl->AddText(ImVec2(content_x + padding, text_y),
-				btn_hovered ? ThemeConfig::GetColorU32("PRIMARY", alpha) : ThemeConfig::GetColorU32("TEXT_DISABLED", alpha),
+				btn_hovered ? ThemeConfig::GetColorU32(ThemeColor::Primary, alpha) : ThemeConfig::GetColorU32(ThemeColor::TextDisabled, alpha),
 				actions[i].icon);
 			float icon_w = ImGui::CalcTextSize(actions[i].icon).x;
 			dl->AddText(ImVec2(content_x + padding + icon_w + padding, text_y),
-				btn_hovered ? ThemeConfig::GetColorU32("TEXT", alpha) : ThemeConfig::GetColorU32("TEXT_DISABLED", alpha),
+				btn_hovered ? ThemeConfig::GetColorU32(ThemeColor::Text, alpha) : ThemeConfig::GetColorU32(ThemeColor::TextDisabled, alpha),
 				Translate(actions[i].labelKey));
 
 			if (btn_clicked) {
@@ -386,22 +386,22 @@ namespace Modex
 
 		// Background.
 		dl->AddRectFilled(cursor, ImVec2(cursor.x + a_width, cursor.y + a_height),
-			ThemeConfig::GetColorU32("BG", 0.4f * alpha), 4.0f);
+			ThemeConfig::GetColorU32(ThemeColor::Bg, 0.4f * alpha), 4.0f);
 
 		// Left border.
 		dl->AddRectFilled(cursor, ImVec2(cursor.x + border_width, cursor.y + a_height),
-			ThemeConfig::GetColorU32("TEXT_DISABLED", 0.6f * alpha), 4.0f, ImDrawFlags_RoundCornersLeft);
+			ThemeConfig::GetColorU32(ThemeColor::TextDisabled, 0.6f * alpha), 4.0f, ImDrawFlags_RoundCornersLeft);
 
 		float content_x = cursor.x + border_width + padding * 2;
 
 		// Header: lightbulb icon + "Did You Know?"
 		dl->AddText(ImVec2(content_x, cursor.y + padding),
-			ThemeConfig::GetColorU32("TEXT_DISABLED", alpha), ICON_LC_LIGHTBULB);
+			ThemeConfig::GetColorU32(ThemeColor::TextDisabled, alpha), ICON_LC_LIGHTBULB);
 		float icon_w = ImGui::CalcTextSize(ICON_LC_LIGHTBULB).x;
 
 		ImGui::PushFontBold();
 		dl->AddText(ImGui::GetFont(), ImGui::GetFontSize(), ImVec2(content_x + icon_w + padding, cursor.y + padding),
-			ThemeConfig::GetColorU32("TEXT", alpha), Translate("HOME_TIP_HEADER"));
+			ThemeConfig::GetColorU32(ThemeColor::Text, alpha), Translate("HOME_TIP_HEADER"));
 		ImGui::PopFont();
 
 		// Rotating tip text.
@@ -425,7 +425,7 @@ namespace Modex
 		float wrap_width = a_width - border_width - padding * 5;
 
 		dl->AddText(ImGui::GetFont(), ImGui::GetFontSize(), ImVec2(text_x, text_y),
-			ThemeConfig::GetColorU32("TEXT_DISABLED", alpha), Translate(tip_keys[tip_index]),
+			ThemeConfig::GetColorU32(ThemeColor::TextDisabled, alpha), Translate(tip_keys[tip_index]),
 			nullptr, wrap_width);
 
 		// Advance cursor.
@@ -529,6 +529,8 @@ namespace Modex
 			DrawShortcutEntry("Right-click",            "HOME_SHORTCUT_RIGHTCLICK");
 			DrawShortcutEntry("Ctrl + Left Arrow",      "HOME_SHORTCUT_CTRL_LEFT");
 			DrawShortcutEntry("F",                      "HOME_SHORTCUT_F");
+			DrawShortcutEntry("Ctrl + Z",               "HOME_SHORTCUT_CTRL_Z");
+			DrawShortcutEntry("Ctrl + Y",               "HOME_SHORTCUT_CTRL_Y");
 
 			ImGui::NewLine();
 